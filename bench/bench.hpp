@@ -0,0 +1,144 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_BENCH_HPP
+#define STRONG_TYPE_BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A deliberately tiny benchmark harness. Each suite times the same hot loop
+// written on raw underlying types and on strong types, so that the ratio
+// between the two is the abstraction penalty. Results are printed as CSV or
+// JSON by bench_main.cpp.
+
+namespace bench {
+
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+struct measurement
+{
+    std::string suite;
+    std::string variant;
+    std::size_t items;
+    std::string metric;
+    double value;
+};
+
+struct options
+{
+    std::size_t items = 1U << 20;
+    std::size_t repetitions = 15;
+    std::string filter;
+};
+
+class runner
+{
+public:
+    explicit runner(const options& opts) : opts_(opts) {}
+
+    std::size_t items() const { return opts_.items; }
+
+    // Run body() repetitions times, after one warm-up round, and record the
+    // median and minimum time per item. body() must process items() items.
+    template <typename F>
+    void time(const char* suite, const char* variant, F&& body)
+    {
+        if (!selected(suite)) return;
+        using clock = std::chrono::steady_clock;
+        body();
+        std::vector<double> samples;
+        samples.reserve(opts_.repetitions);
+        for (std::size_t i = 0; i != opts_.repetitions; ++i)
+        {
+            auto start = clock::now();
+            body();
+            auto stop = clock::now();
+            std::chrono::duration<double, std::nano> elapsed = stop - start;
+            samples.push_back(elapsed.count() / static_cast<double>(opts_.items));
+        }
+        std::sort(samples.begin(), samples.end());
+        record(suite, variant, "ns_per_item", samples[samples.size() / 2]);
+        record(suite, variant, "ns_per_item_min", samples.front());
+    }
+
+    // Record a value that is not a time, e.g. an average probe length.
+    void record(const char* suite, const char* variant, const char* metric, double value)
+    {
+        if (!selected(suite)) return;
+        results_.push_back(measurement{suite, variant, opts_.items, metric, value});
+    }
+
+    const std::vector<measurement>& results() const { return results_; }
+private:
+    bool selected(const char* suite) const
+    {
+        return opts_.filter.empty() || std::string(suite).find(opts_.filter) != std::string::npos;
+    }
+    options opts_;
+    std::vector<measurement> results_;
+};
+
+using suite_function = void(*)(runner&);
+
+inline std::vector<suite_function>& suites()
+{
+    static std::vector<suite_function> s;
+    return s;
+}
+
+struct registrar
+{
+    explicit registrar(suite_function f) { suites().push_back(f); }
+};
+
+// Deterministic pseudo random numbers, so that every run sorts and looks up
+// the same data.
+class xorshift
+{
+public:
+    explicit xorshift(std::uint64_t seed = 0x9E3779B97F4A7C15ULL) : state_(seed) {}
+    std::uint64_t operator()()
+    {
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 7;
+        state_ ^= state_ << 17;
+        return state_;
+    }
+private:
+    std::uint64_t state_;
+};
+
+}
+
+#define BENCH_CAT2(a, b) a ## b
+#define BENCH_CAT(a, b) BENCH_CAT2(a, b)
+#define BENCH_SUITE(name, runner_name)                                     \
+    static void name(bench::runner&);                                      \
+    static const bench::registrar BENCH_CAT(name, _registrar){&name};      \
+    static void name(bench::runner& runner_name)
+
+#endif //STRONG_TYPE_BENCH_HPP
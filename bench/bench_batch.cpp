@@ -0,0 +1,57 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <strong_type/batch.hpp>
+#include <strong_type/arithmetic.hpp>
+#include <strong_type/scalable_with.hpp>
+
+namespace {
+using meters = strong::type<float, struct meters_, strong::arithmetic, strong::scalable_with<float>>;
+}
+
+// out = a * k + b, over arrays whose size is a multiple of the simd width.
+BENCH_SUITE(batch_axpy, r)
+{
+    bench::xorshift rnd;
+    const auto size = r.items() - r.items() % strong::simd_width<meters>;
+    std::vector<float> raw_a(size);
+    std::vector<float> raw_b(size);
+    for (auto& v : raw_a) v = static_cast<float>(rnd() % 1000U);
+    for (auto& v : raw_b) v = static_cast<float>(rnd() % 1000U);
+    std::vector<float> raw_out(size);
+    std::vector<meters> a(raw_a.begin(), raw_a.end());
+    std::vector<meters> b(raw_b.begin(), raw_b.end());
+    std::vector<meters> out(size, meters{0.0f});
+    const float k = 1.5f;
+
+    r.time("batch_axpy", "raw", [&] {
+        for (std::size_t i = 0; i != size; ++i) raw_out[i] = raw_a[i] * k + raw_b[i];
+        bench::do_not_optimize(raw_out.front());
+    });
+    r.time("batch_axpy", "strong_scalar", [&] {
+        for (std::size_t i = 0; i != size; ++i) out[i] = a[i] * k + b[i];
+        bench::do_not_optimize(out.front());
+    });
+    r.time("batch_axpy", "strong_simd", [&] {
+        using simd = strong::simd<meters>;
+        for (std::size_t i = 0; i != size; i += simd::size())
+        {
+            auto va = simd::load(&a[i]);
+            auto vb = simd::load(&b[i]);
+            (va * k + vb).store(&out[i]);
+        }
+        bench::do_not_optimize(out.front());
+    });
+}
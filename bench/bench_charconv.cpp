@@ -0,0 +1,105 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <strong_type/charconv.hpp>
+#include <strong_type/iostreamable.hpp>
+
+#if STRONG_TYPE_HAS_CHARCONV
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+using offset = strong::type<long, struct offset_, strong::charconv, strong::iostreamable>;
+
+std::vector<std::string> make_numbers(std::size_t n)
+{
+    bench::xorshift rnd;
+    std::vector<std::string> r;
+    r.reserve(n);
+    for (std::size_t i = 0; i != n; ++i) r.push_back(std::to_string(static_cast<long>(rnd() % 2000000000) - 1000000000));
+    return r;
+}
+}
+
+// Parsing and printing integers, with std::from_chars and std::to_chars on
+// the underlying type, through the charconv modifier, and with the
+// iostreamable modifier.
+BENCH_SUITE(charconv_parse, r)
+{
+    const auto numbers = make_numbers(r.items());
+    r.time("charconv_parse", "raw", [&] {
+        long sum = 0;
+        for (const auto& s : numbers)
+        {
+            long v = 0;
+            std::from_chars(s.data(), s.data() + s.size(), v);
+            sum += v;
+        }
+        bench::do_not_optimize(sum);
+    });
+    r.time("charconv_parse", "parse", [&] {
+        long sum = 0;
+        for (const auto& s : numbers) sum += value_of(strong::parse<offset>(s).value);
+        bench::do_not_optimize(sum);
+    });
+    r.time("charconv_parse", "istream", [&] {
+        long sum = 0;
+        std::istringstream is;
+        for (const auto& s : numbers)
+        {
+            is.clear();
+            is.str(s);
+            offset v{0};
+            is >> v;
+            sum += value_of(v);
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+BENCH_SUITE(charconv_format, r)
+{
+    bench::xorshift rnd;
+    std::vector<offset> values;
+    values.reserve(r.items());
+    for (std::size_t i = 0; i != r.items(); ++i) values.emplace_back(static_cast<long>(rnd() % 2000000000) - 1000000000);
+    r.time("charconv_format", "raw", [&] {
+        std::size_t length = 0;
+        char buf[24];
+        for (const auto& v : values) length += static_cast<std::size_t>(std::to_chars(buf, buf + sizeof(buf), value_of(v)).ptr - buf);
+        bench::do_not_optimize(length);
+    });
+    r.time("charconv_format", "to_chars", [&] {
+        std::size_t length = 0;
+        char buf[24];
+        for (const auto& v : values) length += static_cast<std::size_t>(to_chars(buf, buf + sizeof(buf), v).ptr - buf);
+        bench::do_not_optimize(length);
+    });
+    r.time("charconv_format", "ostream", [&] {
+        std::size_t length = 0;
+        std::ostringstream os;
+        for (const auto& v : values)
+        {
+            os.str(std::string());
+            os << v;
+            length += static_cast<std::size_t>(os.tellp());
+        }
+        bench::do_not_optimize(length);
+    });
+}
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <strong_type/arithmetic.hpp>
+#include <strong_type/checked_arithmetic.hpp>
+
+#include <limits>
+#include <stdexcept>
+
+namespace {
+using plain = strong::type<std::int64_t, struct plain_, strong::arithmetic>;
+using checked = strong::type<std::int64_t, struct checked_, strong::checked_arithmetic<>>;
+using sticky = strong::type<std::int64_t, struct sticky_, strong::checked_arithmetic<strong::sticky_overflow>>;
+
+// The overflow check written by hand, two compares and a branch before
+// every addition.
+std::int64_t precheck_add(std::int64_t a, std::int64_t b)
+{
+    if ((b > 0 && a > std::numeric_limits<std::int64_t>::max() - b)
+        || (b < 0 && a < std::numeric_limits<std::int64_t>::min() - b))
+    {
+        throw std::overflow_error("+");
+    }
+    return a + b;
+}
+
+// Amounts that never overflow when summed, which is the common case the
+// checks must not slow down.
+std::vector<std::int64_t> amounts(std::size_t n)
+{
+    bench::xorshift rnd;
+    std::vector<std::int64_t> v(n);
+    for (auto& a : v) a = static_cast<std::int64_t>(rnd() % 2000000U) - 1000000;
+    return v;
+}
+
+template <typename T>
+std::vector<T> as(const std::vector<std::int64_t>& raw)
+{
+    std::vector<T> v;
+    v.reserve(raw.size());
+    for (auto a : raw) v.emplace_back(a);
+    return v;
+}
+}
+
+BENCH_SUITE(checked_add, r)
+{
+    const auto raw = amounts(r.items());
+    const auto p = as<plain>(raw);
+    const auto c = as<checked>(raw);
+    const auto s = as<sticky>(raw);
+    r.time("checked_add", "raw", [&] {
+        std::int64_t sum = 0;
+        for (auto a : raw) sum += a;
+        bench::do_not_optimize(sum);
+    });
+    r.time("checked_add", "precheck", [&] {
+        std::int64_t sum = 0;
+        for (auto a : raw) sum = precheck_add(sum, a);
+        bench::do_not_optimize(sum);
+    });
+    r.time("checked_add", "arithmetic", [&] {
+        plain sum{0};
+        for (auto a : p) sum += a;
+        bench::do_not_optimize(sum);
+    });
+    r.time("checked_add", "checked_throw", [&] {
+        checked sum{0};
+        for (auto a : c) sum += a;
+        bench::do_not_optimize(sum);
+    });
+    r.time("checked_add", "checked_sticky", [&] {
+        sticky sum{0};
+        for (auto a : s) sum += a;
+        bench::do_not_optimize(sum);
+        bench::do_not_optimize(strong::sticky_overflow::occurred());
+    });
+}
+
+BENCH_SUITE(checked_mul, r)
+{
+    auto raw = amounts(r.items());
+    for (auto& a : raw) a = a % 16 + 17;
+    const auto p = as<plain>(raw);
+    const auto c = as<checked>(raw);
+    r.time("checked_mul", "raw", [&] {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i + 1 < raw.size(); ++i) sum += raw[i] * raw[i + 1];
+        bench::do_not_optimize(sum);
+    });
+    r.time("checked_mul", "arithmetic", [&] {
+        plain sum{0};
+        for (std::size_t i = 0; i + 1 < p.size(); ++i) sum += p[i] * p[i + 1];
+        bench::do_not_optimize(sum);
+    });
+    r.time("checked_mul", "checked_throw", [&] {
+        checked sum{0};
+        for (std::size_t i = 0; i + 1 < c.size(); ++i) sum += c[i] * c[i + 1];
+        bench::do_not_optimize(sum);
+    });
+}
@@ -0,0 +1,71 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <strong_type/flat_map.hpp>
+#include <strong_type/ordered.hpp>
+#include <strong_type/regular.hpp>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace {
+using key = strong::type<std::uint32_t, struct key_, strong::regular, strong::ordered>;
+
+template <typename Map>
+void time_lookups(bench::runner& r, const char* suite, const char* name, const Map& m, const std::vector<key>& keys)
+{
+    r.time(suite, name, [&] {
+        std::uint64_t sum = 0;
+        for (auto k : keys) sum += m.find(k)->second;
+        bench::do_not_optimize(sum);
+    });
+}
+
+// Random lookups of keys that are in a table of n entries, in a std::map
+// and in flat_maps with each layout.
+void flat_map_lookup(bench::runner& r, const char* suite, std::size_t n)
+{
+    bench::xorshift rnd;
+    std::vector<std::pair<key, std::uint32_t>> kvs;
+    kvs.reserve(n);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        kvs.emplace_back(static_cast<std::uint32_t>(rnd()), static_cast<std::uint32_t>(i));
+    }
+    const std::map<key, std::uint32_t> map(kvs.begin(), kvs.end());
+    const strong::flat_map<key, std::uint32_t> sorted(kvs.begin(), kvs.end());
+    const strong::flat_map<key, std::uint32_t, std::less<key>, strong::layout::eytzinger> eytzinger(kvs.begin(), kvs.end());
+
+    std::vector<key> keys;
+    keys.reserve(r.items());
+    for (std::size_t i = 0; i != r.items(); ++i) keys.push_back(kvs[rnd() % n].first);
+
+    time_lookups(r, suite, "std_map", map, keys);
+    time_lookups(r, suite, "flat_map_sorted", sorted, keys);
+    time_lookups(r, suite, "flat_map_eytzinger", eytzinger, keys);
+}
+}
+
+// A table that fits in the L2 cache, and one that does not fit in any cache.
+BENCH_SUITE(flat_map_lookup_small, r)
+{
+    flat_map_lookup(r, "flat_map_lookup_small", std::size_t{1} << 12);
+}
+
+BENCH_SUITE(flat_map_lookup_large, r)
+{
+    flat_map_lookup(r, "flat_map_lookup_large", std::size_t{1} << 22);
+}
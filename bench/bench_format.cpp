@@ -0,0 +1,112 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <strong_type/formattable.hpp>
+#include <strong_type/ostreamable.hpp>
+
+#include <fmt/compile.h>
+#include <fmt/ostream.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+using streamed_id = strong::type<long, struct streamed_id_, strong::ostreamable>;
+using formattable_id = strong::type<long, struct formattable_id_, strong::formattable>;
+using streamed_name = strong::type<std::string, struct streamed_name_, strong::ostreamable>;
+
+template <typename T, typename F>
+void time_format(bench::runner& r, const char* suite, const char* name, const std::vector<T>& values, F format)
+{
+    r.time(suite, name, [&] {
+        fmt::memory_buffer buf;
+        for (const auto& v : values)
+        {
+            buf.clear();
+            format(buf, v);
+        }
+        bench::do_not_optimize(buf.data());
+    });
+}
+}
+
+// Formatting with fmt into a reused buffer: the underlying value, a
+// formattable strong type, an ostreamable strong type, which now uses the
+// formatter of the underlying type, and the same type through
+// fmt::streamed(), which is the std::ostream path it used before.
+BENCH_SUITE(fmt_format_integer, r)
+{
+    bench::xorshift rnd;
+    std::vector<long> raw;
+    raw.reserve(r.items());
+    for (std::size_t i = 0; i != r.items(); ++i) raw.push_back(static_cast<long>(rnd() >> 16));
+    const std::vector<formattable_id> formattable(raw.begin(), raw.end());
+    const std::vector<streamed_id> streamed(raw.begin(), raw.end());
+
+    time_format(r, "fmt_format_integer", "raw", raw,
+                [](fmt::memory_buffer& b, long v) { fmt::format_to(std::back_inserter(b), "{}", v); });
+    time_format(r, "fmt_format_integer", "formattable", formattable,
+                [](fmt::memory_buffer& b, const formattable_id& v) { fmt::format_to(std::back_inserter(b), "{}", v); });
+    time_format(r, "fmt_format_integer", "ostreamable", streamed,
+                [](fmt::memory_buffer& b, const streamed_id& v) { fmt::format_to(std::back_inserter(b), "{}", v); });
+    time_format(r, "fmt_format_integer", "ostream_formatter", streamed,
+                [](fmt::memory_buffer& b, const streamed_id& v) { fmt::format_to(std::back_inserter(b), "{}", fmt::streamed(v)); });
+}
+
+BENCH_SUITE(fmt_format_string, r)
+{
+    std::vector<std::string> raw;
+    raw.reserve(r.items());
+    for (std::size_t i = 0; i != r.items(); ++i) raw.push_back("name_" + std::to_string(i % 1000));
+    const std::vector<streamed_name> streamed(raw.begin(), raw.end());
+
+    time_format(r, "fmt_format_string", "raw", raw,
+                [](fmt::memory_buffer& b, const std::string& v) { fmt::format_to(std::back_inserter(b), "{}", v); });
+    time_format(r, "fmt_format_string", "ostreamable", streamed,
+                [](fmt::memory_buffer& b, const streamed_name& v) { fmt::format_to(std::back_inserter(b), "{}", v); });
+    time_format(r, "fmt_format_string", "ostream_formatter", streamed,
+                [](fmt::memory_buffer& b, const streamed_name& v) { fmt::format_to(std::back_inserter(b), "{}", fmt::streamed(v)); });
+}
+
+// Formatting into a fixed size char buffer, with a format string compiled
+// by FMT_COMPILE, and with strong::format_to_n(), which needs no format
+// string.
+BENCH_SUITE(fmt_format_to_n_integer, r)
+{
+    bench::xorshift rnd;
+    std::vector<long> raw;
+    raw.reserve(r.items());
+    for (std::size_t i = 0; i != r.items(); ++i) raw.push_back(static_cast<long>(rnd() >> 16));
+    const std::vector<formattable_id> formattable(raw.begin(), raw.end());
+
+    r.time("fmt_format_to_n_integer", "raw", [&] {
+        char buf[24];
+        std::size_t length = 0;
+        for (auto v : raw) length += fmt::format_to_n(buf, sizeof(buf), FMT_COMPILE("{}"), v).size;
+        bench::do_not_optimize(length);
+    });
+    r.time("fmt_format_to_n_integer", "fmt_compile", [&] {
+        char buf[24];
+        std::size_t length = 0;
+        for (const auto& v : formattable) length += fmt::format_to_n(buf, sizeof(buf), FMT_COMPILE("{}"), v).size;
+        bench::do_not_optimize(length);
+    });
+    r.time("fmt_format_to_n_integer", "strong_format_to_n", [&] {
+        char buf[24];
+        std::size_t length = 0;
+        for (const auto& v : formattable) length += strong::format_to_n(buf, sizeof(buf), v).size;
+        bench::do_not_optimize(length);
+    });
+}
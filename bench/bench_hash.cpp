@@ -0,0 +1,190 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <strong_type/cached_hash.hpp>
+#include <strong_type/hashable.hpp>
+#include <strong_type/interned.hpp>
+#include <strong_type/regular.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+using id = strong::type<std::uint64_t, struct id_, strong::regular, strong::hashable>;
+using murmur_id = strong::type<std::uint64_t, struct murmur_id_, strong::regular, strong::hashable_with<strong::murmur_mix_hash>>;
+using folded_id = strong::type<std::uint64_t, struct folded_id_, strong::regular, strong::hashable_with<strong::folded_multiply_hash>>;
+using name = strong::type<std::string, struct name_, strong::regular, strong::hashable>;
+using cached_name = strong::type<std::string, struct cached_name_, strong::regular, strong::cached_hash>;
+
+// An open addressing table with linear probing and a power of two number of
+// buckets, indexed by the low bits of the hash, like the flat hash maps.
+// Filled to half its capacity.
+template <typename K>
+class flat_set
+{
+public:
+    explicit flat_set(std::size_t n)
+    {
+        std::size_t capacity = 1;
+        while (capacity < 2 * n) capacity *= 2;
+        mask_ = capacity - 1;
+        slots_.resize(capacity);
+        used_.resize(capacity);
+    }
+    void insert(const K& k)
+    {
+        std::size_t i = std::hash<K>{}(k) & mask_;
+        while (used_[i]) i = (i + 1) & mask_;
+        slots_[i] = k;
+        used_[i] = true;
+    }
+    // The number of slots looked at to find k, or to find that it isn't there.
+    std::size_t probes(const K& k) const
+    {
+        std::size_t i = std::hash<K>{}(k) & mask_;
+        std::size_t n = 1;
+        while (used_[i] && slots_[i] != k)
+        {
+            i = (i + 1) & mask_;
+            ++n;
+        }
+        return n;
+    }
+private:
+    std::size_t mask_ = 0;
+    std::vector<K> slots_;
+    std::vector<char> used_;
+};
+
+template <typename K>
+void measure(bench::runner& r, const char* suite, const char* variant, std::uint64_t stride)
+{
+    const std::size_t n = r.items() / 2;
+    flat_set<K> set(n);
+    for (std::size_t i = 0; i != n; ++i) set.insert(K{i * stride});
+    // Hits are the inserted ids, misses are the next n ids in sequence, as
+    // when looking up ids allocated after the table was built.
+    std::size_t hit = 0;
+    std::size_t miss = 0;
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        hit += set.probes(K{i * stride});
+        miss += set.probes(K{(n + i) * stride});
+    }
+    r.record(suite, variant, "avg_probes_hit", static_cast<double>(hit) / static_cast<double>(n));
+    r.record(suite, variant, "avg_probes_miss", static_cast<double>(miss) / static_cast<double>(n));
+    r.time(suite, variant, [&] {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            sum += set.probes(K{i * stride});
+            sum += set.probes(K{(n + i) * stride});
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+}
+
+BENCH_SUITE(hash_probe_sequential, r)
+{
+    measure<std::uint64_t>(r, "hash_probe_sequential", "raw", 1);
+    measure<id>(r, "hash_probe_sequential", "hashable", 1);
+    measure<murmur_id>(r, "hash_probe_sequential", "murmur_mix_hash", 1);
+    measure<folded_id>(r, "hash_probe_sequential", "folded_multiply_hash", 1);
+}
+
+// Ids with the low bits always 0, like aligned addresses or ids with a shard
+// number in the low bits.
+BENCH_SUITE(hash_probe_strided, r)
+{
+    measure<std::uint64_t>(r, "hash_probe_strided", "raw", 64);
+    measure<id>(r, "hash_probe_strided", "hashable", 64);
+    measure<murmur_id>(r, "hash_probe_strided", "murmur_mix_hash", 64);
+    measure<folded_id>(r, "hash_probe_strided", "folded_multiply_hash", 64);
+}
+
+namespace {
+// Long strings that share a prefix, like paths or URLs.
+std::vector<std::string> long_strings(std::size_t n)
+{
+    bench::xorshift rnd;
+    std::vector<std::string> v;
+    v.reserve(n);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        v.push_back("/service/tenant/collection/" + std::to_string(rnd()) + "/" + std::to_string(i));
+    }
+    return v;
+}
+
+// Build a set without reserving, so that it rehashes as it grows, and then
+// look up every key, with the same key objects, e.g. kept in a cache.
+template <typename K, typename Equal = std::equal_to<K>>
+void set_build_and_find(bench::runner& r, const char* variant, const std::vector<std::string>& raw)
+{
+    const std::vector<K> keys(raw.begin(), raw.end());
+    r.time("string_set_build_find", variant, [&] {
+        std::unordered_set<K, std::hash<K>, Equal> set;
+        for (const auto& k : keys) set.insert(k);
+        std::size_t found = 0;
+        for (const auto& k : keys) found += set.count(k);
+        bench::do_not_optimize(found);
+    });
+}
+}
+
+BENCH_SUITE(string_set_build_find, r)
+{
+    const auto raw = long_strings(r.items() / 2);
+    set_build_and_find<std::string>(r, "raw", raw);
+    set_build_and_find<name>(r, "hashable", raw);
+    set_build_and_find<cached_name>(r, "cached_hash", raw);
+    set_build_and_find<cached_name, strong::cached_hash_equal<cached_name>>(r, "cached_hash_equal", raw);
+}
+
+#if defined(STRONG_TYPE_HAS_INTERNED)
+namespace {
+using metric_name = strong::interned<struct metric_name_, strong::regular, strong::hashable>;
+}
+
+// Count occurrences of a few hundred distinct metric names, as strings and
+// as interned strings. Interning is done up front, when the names are
+// parsed, so the loop only hashes and compares ids.
+BENCH_SUITE(interned_count, r)
+{
+    const auto distinct = long_strings(512);
+    bench::xorshift rnd;
+    std::vector<std::string> raw;
+    std::vector<metric_name> interned;
+    raw.reserve(r.items());
+    interned.reserve(r.items());
+    for (std::size_t i = 0; i != r.items(); ++i)
+    {
+        raw.push_back(distinct[rnd() % distinct.size()]);
+        interned.emplace_back(raw.back());
+    }
+    r.time("interned_count", "raw", [&] {
+        std::unordered_map<std::string, std::size_t> counts;
+        for (const auto& s : raw) ++counts[s];
+        bench::do_not_optimize(counts.size());
+    });
+    r.time("interned_count", "interned", [&] {
+        std::unordered_map<metric_name, std::size_t> counts;
+        for (auto s : interned) ++counts[s];
+        bench::do_not_optimize(counts.size());
+    });
+}
+#endif
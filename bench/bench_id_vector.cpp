@@ -0,0 +1,53 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <strong_type/hashable.hpp>
+#include <strong_type/id_vector.hpp>
+#include <strong_type/regular.hpp>
+
+#include <unordered_map>
+
+namespace {
+using id = strong::type<std::uint32_t, struct id_, strong::regular, strong::hashable>;
+}
+
+// Random lookups of values keyed on dense ids, in a hash map, which is what
+// id_vector replaces, and in an id_vector.
+BENCH_SUITE(dense_id_lookup, r)
+{
+    const std::size_t n = 1U << 16;
+    std::unordered_map<id, double> map;
+    strong::id_vector<id, double> vec;
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        const auto k = vec.push_back(static_cast<double>(i));
+        map.emplace(k, static_cast<double>(i));
+    }
+    bench::xorshift rnd;
+    std::vector<id> keys;
+    keys.reserve(r.items());
+    for (std::size_t i = 0; i != r.items(); ++i) keys.emplace_back(static_cast<std::uint32_t>(rnd() % n));
+
+    r.time("dense_id_lookup", "unordered_map", [&] {
+        double sum = 0;
+        for (auto k : keys) sum += map.find(k)->second;
+        bench::do_not_optimize(sum);
+    });
+    r.time("dense_id_lookup", "id_vector", [&] {
+        double sum = 0;
+        for (auto k : keys) sum += vec[k];
+        bench::do_not_optimize(sum);
+    });
+}
@@ -0,0 +1,92 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <strong_type/indexed.hpp>
+
+#include <vector>
+
+namespace {
+using index = strong::type<std::size_t, struct index_>;
+
+template <typename Policy>
+using values = strong::type<std::vector<int>, struct values_, strong::indexed<index, Policy>>;
+
+template <typename Policy>
+values<Policy> make_values(std::size_t n)
+{
+    std::vector<int> v(n);
+    bench::xorshift rnd;
+    for (auto& e : v) e = static_cast<int>(rnd() % 1000);
+    return values<Policy>{std::move(v)};
+}
+
+template <typename Policy>
+void time_sequential(bench::runner& r, const char* name)
+{
+    const auto v = make_values<Policy>(r.items());
+    r.time("indexed_sequential_sum", name, [&] {
+        long long sum = 0;
+        for (std::size_t i = 0; i != r.items(); ++i) sum += v[index{i}];
+        bench::do_not_optimize(sum);
+    });
+}
+
+template <typename Policy>
+void time_random(bench::runner& r, const char* name, const std::vector<index>& keys)
+{
+    const auto v = make_values<Policy>(r.items());
+    r.time("indexed_random_sum", name, [&] {
+        long long sum = 0;
+        for (auto k : keys) sum += v[k];
+        bench::do_not_optimize(sum);
+    });
+}
+}
+
+// Summing a vector through a strong index, in order, where the compiler can
+// vectorize the loop if the checks do not get in the way, and at random
+// positions, where the cost of a load hides the checks.
+BENCH_SUITE(indexed_sequential_sum, r)
+{
+    const auto raw = value_of(make_values<strong::bounds::unchecked>(r.items()));
+    r.time("indexed_sequential_sum", "raw", [&] {
+        long long sum = 0;
+        for (std::size_t i = 0; i != r.items(); ++i) sum += raw[i];
+        bench::do_not_optimize(sum);
+    });
+    time_sequential<strong::bounds::unchecked>(r, "unchecked");
+    time_sequential<strong::bounds::checked>(r, "checked");
+    time_sequential<strong::bounds::hardened>(r, "hardened");
+    time_sequential<strong::bounds::assume_in_bounds>(r, "assume_in_bounds");
+}
+
+BENCH_SUITE(indexed_random_sum, r)
+{
+    bench::xorshift rnd;
+    std::vector<index> keys;
+    keys.reserve(r.items());
+    for (std::size_t i = 0; i != r.items(); ++i) keys.emplace_back(static_cast<std::size_t>(rnd() % r.items()));
+
+    const auto raw = value_of(make_values<strong::bounds::unchecked>(r.items()));
+    r.time("indexed_random_sum", "raw", [&] {
+        long long sum = 0;
+        for (auto k : keys) sum += raw[value_of(k)];
+        bench::do_not_optimize(sum);
+    });
+    time_random<strong::bounds::unchecked>(r, "unchecked", keys);
+    time_random<strong::bounds::checked>(r, "checked", keys);
+    time_random<strong::bounds::hardened>(r, "hardened", keys);
+    time_random<strong::bounds::assume_in_bounds>(r, "assume_in_bounds", keys);
+}
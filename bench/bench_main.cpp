@@ -0,0 +1,120 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+void usage(const char* name)
+{
+    std::cerr << "usage: " << name
+              << " [--format=csv|json] [--items=N] [--repetitions=N] [--filter=substring]\n";
+}
+
+// For every timed variant that is not "raw", add the ratio of its median
+// time to that of the "raw" variant of the same suite. 1.0 means no
+// abstraction penalty.
+void add_ratios(std::vector<bench::measurement>& results)
+{
+    std::vector<bench::measurement> ratios;
+    for (auto& m : results)
+    {
+        if (m.metric != "ns_per_item" || m.variant == "raw") continue;
+        for (auto& raw : results)
+        {
+            if (raw.suite == m.suite && raw.variant == "raw" && raw.metric == m.metric && raw.value > 0)
+            {
+                ratios.push_back(bench::measurement{m.suite, m.variant, m.items, "ratio_to_raw", m.value / raw.value});
+            }
+        }
+    }
+    results.insert(results.end(), ratios.begin(), ratios.end());
+}
+
+void print_csv(const std::vector<bench::measurement>& results)
+{
+    std::cout << "suite,variant,items,metric,value\n";
+    for (auto& m : results)
+    {
+        std::cout << m.suite << ',' << m.variant << ',' << m.items << ',' << m.metric << ',' << m.value << '\n';
+    }
+}
+
+void print_json(const std::vector<bench::measurement>& results)
+{
+    std::cout << "[\n";
+    const char* separator = "";
+    for (auto& m : results)
+    {
+        std::cout << separator
+                  << "  {\"suite\": \"" << m.suite
+                  << "\", \"variant\": \"" << m.variant
+                  << "\", \"items\": " << m.items
+                  << ", \"metric\": \"" << m.metric
+                  << "\", \"value\": " << m.value << '}';
+        separator = ",\n";
+    }
+    std::cout << "\n]\n";
+}
+
+bool starts_with(const char* s, const char* prefix)
+{
+    return std::strncmp(s, prefix, std::strlen(prefix)) == 0;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    bench::options opts;
+    bool json = false;
+    for (int i = 1; i != argc; ++i)
+    {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--format=json") == 0) json = true;
+        else if (std::strcmp(arg, "--format=csv") == 0) json = false;
+        else if (starts_with(arg, "--items=")) opts.items = std::strtoul(arg + 8, nullptr, 10);
+        else if (starts_with(arg, "--repetitions=")) opts.repetitions = std::strtoul(arg + 14, nullptr, 10);
+        else if (starts_with(arg, "--filter=")) opts.filter = arg + 9;
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (opts.items == 0 || opts.repetitions == 0)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bench::runner runner(opts);
+    for (auto suite : bench::suites())
+    {
+        suite(runner);
+    }
+    auto results = runner.results();
+    add_ratios(results);
+    std::cout.precision(6);
+    if (json)
+    {
+        print_json(results);
+    }
+    else
+    {
+        print_csv(results);
+    }
+}
@@ -0,0 +1,62 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <strong_type/radix_sort.hpp>
+#include <strong_type/regular.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+using timestamp = strong::type<std::int64_t, struct timestamp_, strong::regular, strong::ordered>;
+using reading = strong::type<double, struct reading_, strong::regular, strong::ordered>;
+
+template <typename T, typename S>
+void sort_suite(bench::runner& r, const char* suite)
+{
+    bench::xorshift rnd;
+    std::vector<T> raw;
+    raw.reserve(r.items());
+    for (std::size_t i = 0; i != r.items(); ++i) raw.push_back(static_cast<T>(static_cast<std::int64_t>(rnd()) >> 8));
+    const std::vector<S> strong_values(raw.begin(), raw.end());
+
+    // Each run sorts a fresh copy, so the copy is part of every variant.
+    r.time(suite, "raw", [&] {
+        auto v = raw;
+        std::sort(v.begin(), v.end());
+        bench::do_not_optimize(v.data());
+    });
+    r.time(suite, "std_sort", [&] {
+        auto v = strong_values;
+        std::sort(v.begin(), v.end());
+        bench::do_not_optimize(v.data());
+    });
+    r.time(suite, "radix_sort", [&] {
+        auto v = strong_values;
+        strong::radix_sort(v);
+        bench::do_not_optimize(v.data());
+    });
+}
+}
+
+BENCH_SUITE(sort_int64, r)
+{
+    sort_suite<std::int64_t, timestamp>(r, "sort_int64");
+}
+
+BENCH_SUITE(sort_double, r)
+{
+    sort_suite<double, reading>(r, "sort_double");
+}
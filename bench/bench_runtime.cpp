@@ -0,0 +1,134 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <strong_type/strong_type.hpp>
+
+#include <unordered_map>
+
+namespace {
+using meters = strong::type<double, struct meters_, strong::arithmetic, strong::ordered, strong::default_constructible>;
+using id = strong::type<std::uint64_t, struct id_, strong::regular, strong::ordered, strong::hashable>;
+using position = strong::type<std::size_t, struct position_, strong::regular, strong::ordered, strong::incrementable>;
+using samples = strong::type<std::vector<int>, struct samples_, strong::range>;
+using table = strong::type<std::vector<int>, struct table_, strong::indexed<position>>;
+}
+
+BENCH_SUITE(accumulate, r)
+{
+    bench::xorshift rnd;
+    std::vector<double> raw(r.items());
+    for (auto& v : raw) v = static_cast<double>(rnd() % 1000U);
+    std::vector<meters> strong(raw.begin(), raw.end());
+
+    r.time("accumulate", "raw", [&] {
+        double sum = 0;
+        for (auto v : raw) sum += v;
+        bench::do_not_optimize(sum);
+    });
+    r.time("accumulate", "strong", [&] {
+        meters sum{0.0};
+        for (auto v : strong) sum += v;
+        bench::do_not_optimize(sum);
+    });
+}
+
+// The copy of the unsorted input is part of the timed loop for both
+// variants, so it cancels out in the ratio.
+BENCH_SUITE(sort, r)
+{
+    bench::xorshift rnd;
+    std::vector<std::uint64_t> raw(r.items());
+    for (auto& v : raw) v = rnd();
+    std::vector<id> strong;
+    strong.reserve(raw.size());
+    for (auto v : raw) strong.emplace_back(v);
+
+    r.time("sort", "raw", [&] {
+        auto copy = raw;
+        std::sort(copy.begin(), copy.end());
+        bench::do_not_optimize(copy.front());
+    });
+    r.time("sort", "strong", [&] {
+        auto copy = strong;
+        std::sort(copy.begin(), copy.end());
+        bench::do_not_optimize(copy.front());
+    });
+}
+
+BENCH_SUITE(hash_lookup, r)
+{
+    bench::xorshift rnd;
+    std::vector<std::uint64_t> keys(r.items());
+    for (auto& k : keys) k = rnd();
+    std::unordered_map<std::uint64_t, std::uint32_t> raw;
+    std::unordered_map<id, std::uint32_t> strong;
+    std::uint32_t n = 0;
+    for (auto k : keys)
+    {
+        raw.emplace(k, n);
+        strong.emplace(id{k}, n);
+        ++n;
+    }
+
+    r.time("hash_lookup", "raw", [&] {
+        std::uint64_t sum = 0;
+        for (auto k : keys) sum += raw.find(k)->second;
+        bench::do_not_optimize(sum);
+    });
+    r.time("hash_lookup", "strong", [&] {
+        std::uint64_t sum = 0;
+        for (auto k : keys) sum += strong.find(id{k})->second;
+        bench::do_not_optimize(sum);
+    });
+}
+
+BENCH_SUITE(range_walk, r)
+{
+    bench::xorshift rnd;
+    std::vector<int> raw(r.items());
+    for (auto& v : raw) v = static_cast<int>(rnd() % 1000U);
+    samples strong{raw};
+
+    r.time("range_walk", "raw", [&] {
+        long sum = 0;
+        for (auto v : raw) sum += v;
+        bench::do_not_optimize(sum);
+    });
+    r.time("range_walk", "strong", [&] {
+        long sum = 0;
+        for (auto v : strong) sum += v;
+        bench::do_not_optimize(sum);
+    });
+}
+
+BENCH_SUITE(indexed_access, r)
+{
+    bench::xorshift rnd;
+    std::vector<int> raw(r.items());
+    for (auto& v : raw) v = static_cast<int>(rnd() % 1000U);
+    table strong{raw};
+    const auto size = raw.size();
+
+    r.time("indexed_access", "raw", [&] {
+        long sum = 0;
+        for (std::size_t i = 0; i != size; ++i) sum += raw[i];
+        bench::do_not_optimize(sum);
+    });
+    r.time("indexed_access", "strong", [&] {
+        long sum = 0;
+        for (position i{0U}; i != position{size}; ++i) sum += strong[i];
+        bench::do_not_optimize(sum);
+    });
+}
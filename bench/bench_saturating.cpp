@@ -0,0 +1,165 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <strong_type/saturating_arithmetic.hpp>
+
+#include <limits>
+#include <numeric>
+
+namespace {
+using quantity = strong::type<std::int32_t, struct quantity_, strong::saturating_arithmetic>;
+
+// Clamping written by hand, with branches, the way it is often done.
+std::int32_t checked_add(std::int32_t a, std::int32_t b)
+{
+    if (b > 0 && a > std::numeric_limits<std::int32_t>::max() - b) return std::numeric_limits<std::int32_t>::max();
+    if (b < 0 && a < std::numeric_limits<std::int32_t>::min() - b) return std::numeric_limits<std::int32_t>::min();
+    return a + b;
+}
+
+std::int32_t checked_mul(std::int32_t a, std::int32_t b)
+{
+    const auto r = static_cast<std::int64_t>(a) * b;
+    if (r > std::numeric_limits<std::int32_t>::max()) return std::numeric_limits<std::int32_t>::max();
+    if (r < std::numeric_limits<std::int32_t>::min()) return std::numeric_limits<std::int32_t>::min();
+    return static_cast<std::int32_t>(r);
+}
+
+// Random operands, so that roughly a quarter of the sums and most of the
+// products saturate, with no pattern for the branch predictor to learn.
+struct operands
+{
+    explicit operands(std::size_t n)
+    {
+        bench::xorshift rnd;
+        raw_a.resize(n);
+        raw_b.resize(n);
+        for (auto& v : raw_a) v = static_cast<std::int32_t>(rnd());
+        for (auto& v : raw_b) v = static_cast<std::int32_t>(rnd() >> (rnd() % 48U));
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            a.emplace_back(raw_a[i]);
+            b.emplace_back(raw_b[i]);
+        }
+    }
+    std::vector<std::int32_t> raw_a;
+    std::vector<std::int32_t> raw_b;
+    std::vector<quantity> a;
+    std::vector<quantity> b;
+};
+}
+
+BENCH_SUITE(saturating_scalar_add, r)
+{
+    operands ops(r.items());
+    r.time("saturating_scalar_add", "raw", [&] {
+        std::int32_t sum = 0;
+        for (std::size_t i = 0; i != ops.raw_a.size(); ++i) sum ^= checked_add(ops.raw_a[i], ops.raw_b[i]);
+        bench::do_not_optimize(sum);
+    });
+#if defined(__cpp_lib_saturation_arithmetic)
+    r.time("saturating_scalar_add", "std", [&] {
+        std::int32_t sum = 0;
+        for (std::size_t i = 0; i != ops.raw_a.size(); ++i) sum ^= std::add_sat(ops.raw_a[i], ops.raw_b[i]);
+        bench::do_not_optimize(sum);
+    });
+#endif
+    r.time("saturating_scalar_add", "strong", [&] {
+        std::int32_t sum = 0;
+        for (std::size_t i = 0; i != ops.a.size(); ++i) sum ^= value_of(ops.a[i] + ops.b[i]);
+        bench::do_not_optimize(sum);
+    });
+}
+
+BENCH_SUITE(saturating_scalar_mul, r)
+{
+    operands ops(r.items());
+    r.time("saturating_scalar_mul", "raw", [&] {
+        std::int32_t sum = 0;
+        for (std::size_t i = 0; i != ops.raw_a.size(); ++i) sum ^= checked_mul(ops.raw_a[i], ops.raw_b[i]);
+        bench::do_not_optimize(sum);
+    });
+#if defined(__cpp_lib_saturation_arithmetic)
+    r.time("saturating_scalar_mul", "std", [&] {
+        std::int32_t sum = 0;
+        for (std::size_t i = 0; i != ops.raw_a.size(); ++i) sum ^= std::mul_sat(ops.raw_a[i], ops.raw_b[i]);
+        bench::do_not_optimize(sum);
+    });
+#endif
+    r.time("saturating_scalar_mul", "strong", [&] {
+        std::int32_t sum = 0;
+        for (std::size_t i = 0; i != ops.a.size(); ++i) sum ^= value_of(ops.a[i] * ops.b[i]);
+        bench::do_not_optimize(sum);
+    });
+}
+
+// The span kernels need std::span, so configure the benchmarks with
+// -DCMAKE_CXX_STANDARD=20 to run these.
+#if defined(STRONG_TYPE_HAS_SPAN)
+
+namespace {
+using sample = strong::type<std::int16_t, struct sample_>;
+using pixel = strong::type<std::uint8_t, struct pixel_>;
+
+template <typename T>
+T naive_add_sat(T a, T b)
+{
+    const int sum = a + b;
+    if (sum > std::numeric_limits<T>::max()) return std::numeric_limits<T>::max();
+    if (sum < std::numeric_limits<T>::min()) return std::numeric_limits<T>::min();
+    return static_cast<T>(sum);
+}
+
+template <typename S>
+void run(bench::runner& r, const char* suite)
+{
+    using U = strong::underlying_type_t<S>;
+    bench::xorshift rnd;
+    std::vector<U> raw_dst(r.items());
+    std::vector<U> raw_src(r.items());
+    for (auto& v : raw_dst) v = static_cast<U>(rnd());
+    for (auto& v : raw_src) v = static_cast<U>(rnd());
+    std::vector<S> dst;
+    std::vector<S> src;
+    for (auto v : raw_dst) dst.emplace_back(v);
+    for (auto v : raw_src) src.emplace_back(v);
+    auto raw_work = raw_dst;
+    auto work = dst;
+
+    // Each round starts from the same data, so that not everything has
+    // saturated after a few rounds. The copy is in both variants.
+    r.time(suite, "raw", [&] {
+        raw_work = raw_dst;
+        for (std::size_t i = 0; i != raw_work.size(); ++i) raw_work[i] = naive_add_sat(raw_work[i], raw_src[i]);
+        bench::do_not_optimize(raw_work.front());
+    });
+    r.time(suite, "strong_span", [&] {
+        work = dst;
+        strong::saturating_add(std::span<S>{work}, src);
+        bench::do_not_optimize(work.front());
+    });
+}
+}
+
+BENCH_SUITE(saturating_add_i16, r)
+{
+    run<sample>(r, "saturating_add_i16");
+}
+
+BENCH_SUITE(saturating_add_u8, r)
+{
+    run<pixel>(r, "saturating_add_u8");
+}
+#endif
@@ -0,0 +1,121 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "bench.hpp"
+
+#include <strong_type/serializable.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+using seq_be = strong::type<std::uint32_t, struct seq_, strong::serializable<strong::endian::big>>;
+using seq_le = strong::type<std::uint32_t, struct seq_, strong::serializable<strong::endian::little>>;
+
+template <typename S>
+std::vector<S> make_values(std::size_t n)
+{
+    bench::xorshift rnd;
+    std::vector<S> r;
+    r.reserve(n);
+    for (std::size_t i = 0; i != n; ++i) r.emplace_back(static_cast<std::uint32_t>(rnd()));
+    return r;
+}
+}
+
+// Writing and reading 32 bit fields in network byte order, with value_of()
+// and shifts, as protocol code does by hand, one at a time with write_to()
+// and read_from(), and all at once with the bulk versions.
+BENCH_SUITE(serialize_big_endian, r)
+{
+    const auto values = make_values<seq_be>(r.items());
+    std::vector<unsigned char> buf(values.size() * seq_be::wire_size());
+    r.time("serialize_big_endian", "raw", [&] {
+        unsigned char* p = buf.data();
+        for (const auto& v : values)
+        {
+            const std::uint32_t u = value_of(v);
+            p[0] = static_cast<unsigned char>(u >> 24);
+            p[1] = static_cast<unsigned char>(u >> 16);
+            p[2] = static_cast<unsigned char>(u >> 8);
+            p[3] = static_cast<unsigned char>(u);
+            p += 4;
+        }
+        bench::do_not_optimize(buf.data());
+    });
+    r.time("serialize_big_endian", "write_to", [&] {
+        unsigned char* p = buf.data();
+        for (const auto& v : values) p = v.write_to(p);
+        bench::do_not_optimize(buf.data());
+    });
+    r.time("serialize_big_endian", "bulk", [&] {
+        write_to(buf.data(), values.data(), values.size());
+        bench::do_not_optimize(buf.data());
+    });
+}
+
+BENCH_SUITE(deserialize_big_endian, r)
+{
+    const auto values = make_values<seq_be>(r.items());
+    std::vector<unsigned char> buf(values.size() * seq_be::wire_size());
+    write_to(buf.data(), values.data(), values.size());
+    std::vector<seq_be> out(values.size(), seq_be{0U});
+    r.time("deserialize_big_endian", "raw", [&] {
+        const unsigned char* p = buf.data();
+        for (auto& v : out)
+        {
+            value_of(v) = std::uint32_t{p[0]} << 24 | std::uint32_t{p[1]} << 16
+                          | std::uint32_t{p[2]} << 8 | std::uint32_t{p[3]};
+            p += 4;
+        }
+        bench::do_not_optimize(out.data());
+    });
+    r.time("deserialize_big_endian", "read_from", [&] {
+        const unsigned char* p = buf.data();
+        for (auto& v : out) p = v.read_from(p);
+        bench::do_not_optimize(out.data());
+    });
+    r.time("deserialize_big_endian", "bulk", [&] {
+        read_from(static_cast<const unsigned char*>(buf.data()), out.data(), out.size());
+        bench::do_not_optimize(out.data());
+    });
+}
+
+// In native byte order, the bulk versions are a single std::memcpy().
+BENCH_SUITE(serialize_little_endian, r)
+{
+    const auto values = make_values<seq_le>(r.items());
+    std::vector<unsigned char> buf(values.size() * seq_le::wire_size());
+    r.time("serialize_little_endian", "raw", [&] {
+        unsigned char* p = buf.data();
+        for (const auto& v : values)
+        {
+            const std::uint32_t u = value_of(v);
+            p[0] = static_cast<unsigned char>(u);
+            p[1] = static_cast<unsigned char>(u >> 8);
+            p[2] = static_cast<unsigned char>(u >> 16);
+            p[3] = static_cast<unsigned char>(u >> 24);
+            p += 4;
+        }
+        bench::do_not_optimize(buf.data());
+    });
+    r.time("serialize_little_endian", "write_to", [&] {
+        unsigned char* p = buf.data();
+        for (const auto& v : values) p = v.write_to(p);
+        bench::do_not_optimize(buf.data());
+    });
+    r.time("serialize_little_endian", "bulk", [&] {
+        write_to(buf.data(), values.data(), values.size());
+        bench::do_not_optimize(buf.data());
+    });
+}
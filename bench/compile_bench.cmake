@@ -0,0 +1,118 @@
+#
+# strong_type C++14/17/20 strong typedef library
+#
+# Copyright (C) Björn Fahller
+#
+#  Use, modification and distribution is subject to the
+#  Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at
+#  http://www.boost.org/LICENSE_1_0.txt)
+#
+# Project home: https://github.com/rollbear/strong_type
+#
+
+# Generates the translation units for the compile time benchmark. TU
+# modifiers_<N>.cpp declares STRONG_TYPE_COMPILE_BENCH_TYPES distinct strong
+# types, each with the first N modifiers of the list below, and queries each
+# of them with strong::type_is_v<>. range.cpp does the same for a range type.
+
+set(STRONG_TYPE_COMPILE_BENCH_TYPES 200 CACHE STRING "Number of strong types per generated translation unit")
+
+set(COMPILE_BENCH_MODIFIERS
+    "strong::regular"
+    "strong::arithmetic"
+    "strong::ordered"
+    "strong::hashable"
+    "strong::ordered_with<int, long>"
+    "strong::scalable_with<int, double>"
+    "strong::equality_with<int, long>"
+    "strong::bicrementable"
+    "strong::iostreamable"
+    "strong::formattable"
+)
+set(COMPILE_BENCH_RANGE_MODIFIERS
+    "strong::regular"
+    "strong::range"
+    "strong::indexed<>"
+    "strong::ordered"
+    "strong::formattable"
+)
+
+set(COMPILE_BENCH_HEADER
+"// generated by compile_bench.cmake, do not edit
+#include <strong_type/strong_type.hpp>
+#include <vector>
+")
+
+function(generate_compile_bench_tu FILE UNDERLYING)
+  set(MODIFIERS ${ARGN})
+  list(JOIN MODIFIERS ", " MODIFIER_LIST)
+  set(CONTENT "${COMPILE_BENCH_HEADER}")
+  math(EXPR LAST "${STRONG_TYPE_COMPILE_BENCH_TYPES} - 1")
+  foreach(I RANGE ${LAST})
+    string(APPEND CONTENT "
+using t${I} = strong::type<${UNDERLYING}, struct t${I}_, ${MODIFIER_LIST}>;
+static_assert(sizeof(t${I}) == sizeof(${UNDERLYING}), \"\");
+")
+    foreach(M IN LISTS MODIFIERS)
+      string(APPEND CONTENT "static_assert(strong::type_is_v<t${I}, ${M}>, \"\");\n")
+    endforeach()
+    string(APPEND CONTENT "static_assert(!strong::type_is_v<t${I}, strong::pointer>, \"\");
+bool equal${I}(const t${I}& a, const t${I}& b) { return a == b; }
+")
+  endforeach()
+  # only rewrite on change, so that a re-configure does not force a rebuild
+  if (EXISTS ${FILE})
+    file(READ ${FILE} OLD_CONTENT)
+  endif()
+  if (NOT "${OLD_CONTENT}" STREQUAL "${CONTENT}")
+    file(WRITE ${FILE} "${CONTENT}")
+  endif()
+endfunction()
+
+set(COMPILE_BENCH_DIR ${CMAKE_CURRENT_BINARY_DIR}/compile_bench)
+set(COMPILE_BENCH_RESULT_DIR ${COMPILE_BENCH_DIR}/results)
+file(MAKE_DIRECTORY ${COMPILE_BENCH_RESULT_DIR})
+
+set(COMPILE_BENCH_SOURCES)
+set(USED_MODIFIERS)
+set(N 0)
+foreach(M IN LISTS COMPILE_BENCH_MODIFIERS)
+  math(EXPR N "${N} + 1")
+  list(APPEND USED_MODIFIERS "${M}")
+  set(TU ${COMPILE_BENCH_DIR}/modifiers_${N}.cpp)
+  generate_compile_bench_tu(${TU} int ${USED_MODIFIERS})
+  list(APPEND COMPILE_BENCH_SOURCES ${TU})
+endforeach()
+set(TU ${COMPILE_BENCH_DIR}/range.cpp)
+generate_compile_bench_tu(${TU} "std::vector<int>" ${COMPILE_BENCH_RANGE_MODIFIERS})
+list(APPEND COMPILE_BENCH_SOURCES ${TU})
+
+add_executable(compile_timer compile_timer.cpp)
+# RULE_LAUNCH_COMPILE does not expand generator expressions, so the launcher
+# must be at a known location. The empty $<0:> keeps multi-config generators
+# from appending a per-configuration directory.
+set_property(TARGET compile_timer PROPERTY RUNTIME_OUTPUT_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}$<0:>")
+set(COMPILE_TIMER ${CMAKE_CURRENT_BINARY_DIR}/compile_timer${CMAKE_EXECUTABLE_SUFFIX})
+
+add_library(strong_type_compile_bench_tus OBJECT EXCLUDE_FROM_ALL ${COMPILE_BENCH_SOURCES})
+target_link_libraries(strong_type_compile_bench_tus PRIVATE strong_type::strong_type)
+set_property(
+  TARGET strong_type_compile_bench_tus
+  PROPERTY RULE_LAUNCH_COMPILE "${COMPILE_TIMER} ${COMPILE_BENCH_RESULT_DIR}"
+)
+add_dependencies(strong_type_compile_bench_tus compile_timer)
+if (CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+  # the .json traces are written next to the object files
+  target_compile_options(strong_type_compile_bench_tus PRIVATE -ftime-trace)
+endif()
+
+add_custom_target(
+  strong_type_compile_bench
+  COMMAND ${CMAKE_COMMAND}
+          -DRESULT_DIR=${COMPILE_BENCH_RESULT_DIR}
+          -DOUTPUT=${CMAKE_CURRENT_BINARY_DIR}/compile_times.csv
+          -P ${CMAKE_CURRENT_SOURCE_DIR}/compile_report.cmake
+  DEPENDS strong_type_compile_bench_tus
+  VERBATIM
+)
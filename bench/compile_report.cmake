@@ -0,0 +1,25 @@
+#
+# strong_type C++14/17/20 strong typedef library
+#
+# Copyright (C) Björn Fahller
+#
+#  Use, modification and distribution is subject to the
+#  Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at
+#  http://www.boost.org/LICENSE_1_0.txt)
+#
+# Project home: https://github.com/rollbear/strong_type
+#
+
+# Collects the per translation unit results written by compile_timer into
+# one CSV file, and prints it.
+
+file(GLOB RESULTS ${RESULT_DIR}/*.csv)
+list(SORT RESULTS COMPARE NATURAL)
+set(REPORT "tu,wall_ms,cpu_ms,max_rss_kb\n")
+foreach(R IN LISTS RESULTS)
+  file(READ ${R} LINE)
+  string(APPEND REPORT "${LINE}")
+endforeach()
+file(WRITE ${OUTPUT} "${REPORT}")
+message("${REPORT}")
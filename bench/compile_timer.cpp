@@ -0,0 +1,125 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+// Compiler launcher used by the compile time benchmark. CMake runs it as
+//
+//   compile_timer <result-dir> <compiler> <args...>
+//
+// It runs the compiler, and writes the wall clock time and, where the
+// platform can tell, the CPU time and peak resident memory of the
+// compilation to <result-dir>/<source-file-name>.csv. The CPU time is the
+// better measure when several compilations run in parallel.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define STRONG_TYPE_COMPILE_TIMER_POSIX 1
+#endif
+
+namespace {
+
+std::string source_name(int argc, char* argv[])
+{
+    for (int i = argc - 1; i > 2; --i)
+    {
+        std::string arg = argv[i];
+        if (arg.size() > 4 && arg.compare(arg.size() - 4, 4, ".cpp") == 0)
+        {
+            auto slash = arg.find_last_of("/\\");
+            return slash == std::string::npos ? arg : arg.substr(slash + 1);
+        }
+    }
+    return "unknown.cpp";
+}
+
+struct outcome
+{
+    int status;
+    double cpu_ms;
+    long max_rss_kb;
+};
+
+#if defined(STRONG_TYPE_COMPILE_TIMER_POSIX)
+outcome run(char* argv[])
+{
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        execvp(argv[0], argv);
+        std::perror(argv[0]);
+        _exit(127);
+    }
+    if (pid < 0)
+    {
+        std::perror("fork");
+        return {1, -1, -1};
+    }
+    int status = 0;
+    rusage usage{};
+    if (wait4(pid, &status, 0, &usage) < 0)
+    {
+        std::perror("wait4");
+        return {1, -1, -1};
+    }
+    auto ms = [](timeval tv) { return static_cast<double>(tv.tv_sec) * 1000.0 + static_cast<double>(tv.tv_usec) / 1000.0; };
+    double cpu_ms = ms(usage.ru_utime) + ms(usage.ru_stime);
+#if defined(__APPLE__)
+    long max_rss_kb = static_cast<long>(usage.ru_maxrss / 1024);
+#else
+    long max_rss_kb = static_cast<long>(usage.ru_maxrss);
+#endif
+    return {WIFEXITED(status) ? WEXITSTATUS(status) : 1, cpu_ms, max_rss_kb};
+}
+#else
+outcome run(char* argv[])
+{
+    std::string command;
+    for (char** arg = argv; *arg; ++arg)
+    {
+        command += '"';
+        command += *arg;
+        command += "\" ";
+    }
+    return {std::system(command.c_str()), -1, -1};
+}
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "usage: " << argv[0] << " result-dir compiler [args...]\n";
+        return 1;
+    }
+    auto start = std::chrono::steady_clock::now();
+    auto result = run(argv + 2);
+    auto stop = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = stop - start;
+
+    if (result.status == 0)
+    {
+        auto name = source_name(argc, argv);
+        std::ofstream out(std::string(argv[1]) + "/" + name + ".csv");
+        out << name << ',' << elapsed.count() << ',' << result.cpu_ms << ',' << result.max_rss_kb << '\n';
+    }
+    return result.status;
+}
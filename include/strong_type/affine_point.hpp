@@ -18,7 +18,7 @@
 
 namespace strong
 {
-template <typename D = void>
+template <typename D>
 struct affine_point
 {
     template <typename T>
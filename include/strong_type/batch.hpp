@@ -0,0 +1,238 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_BATCH_HPP
+#define STRONG_TYPE_BATCH_HPP
+
+#include "type.hpp"
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <array>
+#include <cstddef>
+#endif
+
+// strong::batch<T, N> is N lanes of T, for code that processes several values
+// at once. Every operation is done lane by lane with the operators of T, so a
+// batch of a strong type can do exactly what the strong type can, and
+// nothing else. The lanes are stored as the underlying type, in an array
+// that the compiler can keep in vector registers.
+
+// The width in bytes of the widest vector registers the target is compiled
+// for. Define it to override the guess.
+#ifndef STRONG_SIMD_BYTES
+#if defined(__AVX512F__)
+#define STRONG_SIMD_BYTES 64
+#elif defined(__AVX__)
+#define STRONG_SIMD_BYTES 32
+#else
+#define STRONG_SIMD_BYTES 16
+#endif
+#endif
+
+namespace strong
+{
+template <typename T, std::size_t N>
+class batch;
+
+namespace impl
+{
+template <typename T>
+struct is_batch : std::false_type {};
+
+template <typename T, std::size_t N>
+struct is_batch<batch<T, N>> : std::true_type {};
+
+template <typename T>
+using WhenNotBatch = std::enable_if_t<!is_batch<std::decay_t<T>>::value>;
+
+template <typename A, typename B>
+using plus_t = std::decay_t<decltype(std::declval<const A&>() + std::declval<const B&>())>;
+template <typename A, typename B>
+using minus_t = std::decay_t<decltype(std::declval<const A&>() - std::declval<const B&>())>;
+template <typename A, typename B>
+using multiplies_t = std::decay_t<decltype(std::declval<const A&>() * std::declval<const B&>())>;
+template <typename A, typename B>
+using divides_t = std::decay_t<decltype(std::declval<const A&>() / std::declval<const B&>())>;
+template <typename A, typename B>
+using modulus_t = std::decay_t<decltype(std::declval<const A&>() % std::declval<const B&>())>;
+}
+
+// The number of lanes of T that fit in a vector register.
+template <typename T>
+constexpr std::size_t simd_width
+    = sizeof(underlying_type_t<T>) >= STRONG_SIMD_BYTES
+      ? 1U
+      : STRONG_SIMD_BYTES / sizeof(underlying_type_t<T>);
+
+template <typename T>
+using simd = batch<T, simd_width<T>>;
+
+template <typename T, std::size_t N>
+class batch
+{
+    static_assert(N > 0, "A batch must have at least one lane");
+    using U = underlying_type_t<T>;
+public:
+    using value_type = T;
+    using underlying_type = std::array<U, N>;
+
+    // All lanes are value initialized.
+    constexpr batch() noexcept(std::is_nothrow_default_constructible<U>::value)
+        : lanes_{}
+    {
+    }
+
+    // All lanes are t.
+    constexpr explicit batch(const T& t) noexcept(std::is_nothrow_copy_assignable<U>::value)
+        : lanes_{}
+    {
+        for (auto& lane : lanes_) lane = impl::access(t);
+    }
+
+    STRONG_NODISCARD
+    static constexpr std::size_t size() noexcept { return N; }
+
+    // Read N values from p.
+    STRONG_NODISCARD
+    static constexpr batch load(const T* p) noexcept(std::is_nothrow_copy_assignable<U>::value)
+    {
+        batch b;
+        for (std::size_t i = 0; i != N; ++i) b.lanes_[i] = impl::access(p[i]);
+        return b;
+    }
+
+    // Write the N lanes to p.
+    constexpr void store(T* p) const noexcept(std::is_nothrow_copy_assignable<T>::value)
+    {
+        for (std::size_t i = 0; i != N; ++i) p[i] = (*this)[i];
+    }
+
+    STRONG_NODISCARD
+    constexpr T operator[](std::size_t i) const
+    {
+        return T{lanes_[i]};
+    }
+
+    STRONG_NODISCARD
+    friend constexpr underlying_type& value_of(batch& b) noexcept { return b.lanes_; }
+
+    STRONG_NODISCARD
+    friend constexpr const underlying_type& value_of(const batch& b) noexcept { return b.lanes_; }
+private:
+    underlying_type lanes_;
+};
+
+// Lane by lane arithmetic, between two batches or between a batch and a
+// single value, which is used in every lane. An operation is only available
+// if it is for the lane types, and the result is a batch of whatever the
+// operation on the lane types gives, e.g. a batch of differences when
+// subtracting two batches of strong::affine_point.
+#define STRONG_BATCH_OPERATOR(op, result)                                     \
+template <typename A, typename B, std::size_t N>                              \
+STRONG_NODISCARD                                                              \
+constexpr                                                                     \
+batch<impl::result<A, B>, N>                                                  \
+operator op(const batch<A, N>& lh, const batch<B, N>& rh)                     \
+{                                                                             \
+    batch<impl::result<A, B>, N> r;                                           \
+    for (std::size_t i = 0; i != N; ++i)                                      \
+        value_of(r)[i] = impl::access(lh[i] op rh[i]);                        \
+    return r;                                                                 \
+}                                                                             \
+template <typename A, typename B, std::size_t N,                              \
+          typename = impl::WhenNotBatch<B>>                                   \
+STRONG_NODISCARD                                                              \
+constexpr                                                                     \
+batch<impl::result<A, B>, N>                                                  \
+operator op(const batch<A, N>& lh, const B& rh)                               \
+{                                                                             \
+    batch<impl::result<A, B>, N> r;                                           \
+    for (std::size_t i = 0; i != N; ++i)                                      \
+        value_of(r)[i] = impl::access(lh[i] op rh);                           \
+    return r;                                                                 \
+}                                                                             \
+template <typename A, typename B, std::size_t N,                              \
+          typename = impl::WhenNotBatch<A>>                                   \
+STRONG_NODISCARD                                                              \
+constexpr                                                                     \
+batch<impl::result<A, B>, N>                                                  \
+operator op(const A& lh, const batch<B, N>& rh)                               \
+{                                                                             \
+    batch<impl::result<A, B>, N> r;                                           \
+    for (std::size_t i = 0; i != N; ++i)                                      \
+        value_of(r)[i] = impl::access(lh op rh[i]);                           \
+    return r;                                                                 \
+}                                                                             \
+template <typename A, typename B, std::size_t N,                              \
+          typename = decltype(std::declval<A&>() op##= std::declval<const B&>())> \
+constexpr                                                                     \
+batch<A, N>&                                                                  \
+operator op##=(batch<A, N>& lh, const batch<B, N>& rh)                        \
+{                                                                             \
+    for (std::size_t i = 0; i != N; ++i)                                      \
+    {                                                                         \
+        A a = lh[i];                                                          \
+        a op##= rh[i];                                                        \
+        value_of(lh)[i] = impl::access(a);                                    \
+    }                                                                         \
+    return lh;                                                                \
+}                                                                             \
+template <typename A, typename B, std::size_t N,                              \
+          typename = impl::WhenNotBatch<B>,                                   \
+          typename = decltype(std::declval<A&>() op##= std::declval<const B&>())> \
+constexpr                                                                     \
+batch<A, N>&                                                                  \
+operator op##=(batch<A, N>& lh, const B& rh)                                  \
+{                                                                             \
+    for (std::size_t i = 0; i != N; ++i)                                      \
+    {                                                                         \
+        A a = lh[i];                                                          \
+        a op##= rh;                                                           \
+        value_of(lh)[i] = impl::access(a);                                    \
+    }                                                                         \
+    return lh;                                                                \
+}
+
+STRONG_BATCH_OPERATOR(+, plus_t)
+STRONG_BATCH_OPERATOR(-, minus_t)
+STRONG_BATCH_OPERATOR(*, multiplies_t)
+STRONG_BATCH_OPERATOR(/, divides_t)
+STRONG_BATCH_OPERATOR(%, modulus_t)
+
+#undef STRONG_BATCH_OPERATOR
+
+template <typename T, std::size_t N, typename R = std::decay_t<decltype(-std::declval<const T&>())>>
+STRONG_NODISCARD
+constexpr
+batch<R, N>
+operator-(const batch<T, N>& b)
+{
+    batch<R, N> r;
+    for (std::size_t i = 0; i != N; ++i) value_of(r)[i] = impl::access(-b[i]);
+    return r;
+}
+
+// The sum of all lanes, using operator+ of T.
+template <typename T, std::size_t N, typename = decltype(std::declval<const T&>() + std::declval<const T&>())>
+STRONG_NODISCARD
+constexpr
+T
+reduce_add(const batch<T, N>& b)
+{
+    T sum = b[0];
+    for (std::size_t i = 1; i != N; ++i) sum = sum + b[i];
+    return sum;
+}
+}
+
+#endif //STRONG_TYPE_BATCH_HPP
@@ -0,0 +1,198 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_CACHED_HASH_HPP
+#define STRONG_TYPE_CACHED_HASH_HPP
+
+#include "type.hpp"
+#include "hashable.hpp"
+#include "transparent.hpp"
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <atomic>
+#endif
+
+namespace strong
+{
+struct cached_hash
+{
+    template <typename T, typename = void>
+    class modifier
+    {
+        static_assert(impl::always_false<T>,
+                      "Underlying type must be hashable with std::hash");
+    };
+};
+
+// The hash is computed by std::hash of the underlying value the first time it
+// is asked for, and then stored until a non-const reference to the value is
+// handed out, by value_of(), swap() or an operator of another modifier.
+//
+// The stored hash is dropped when the reference is handed out, not when the
+// value is written through it. A reference kept from before the hash is
+// computed, and written to after, leaves a stale hash:
+//
+//   auto& r = value_of(x);
+//   (void)x.hash();
+//   r = other;          // x.hash() is still the hash of the old value
+//
+// Don't keep such references. Equality always compares the values, so ==
+// is right even then, but lookups in hash containers are not.
+//
+// The stored hash and its valid flag are atomic, so that several threads can
+// hash the same const object, e.g. a key in a shared map. They all compute
+// the same value, so it does not matter which store wins.
+template <typename T, typename Tag, typename ... M>
+class cached_hash::modifier<
+    ::strong::type<T, Tag, M...>,
+    impl::void_t<decltype(std::hash<T>{}(std::declval<const T&>()))>
+>
+{
+    using type = ::strong::type<T, Tag, M...>;
+    static_assert(!impl::has_hash_modifier<M...>::value,
+                  "cached_hash provides std::hash, use it instead of hashable or hashable_with, not with them");
+public:
+    modifier() = default;
+
+    modifier(const modifier& m) noexcept
+    {
+        copy_from(m);
+    }
+
+    modifier(modifier&& m) noexcept
+    {
+        copy_from(m);
+        m.valid_.store(false, std::memory_order_relaxed);
+    }
+
+    modifier& operator=(const modifier& m) noexcept
+    {
+        copy_from(m);
+        return *this;
+    }
+
+    modifier& operator=(modifier&& m) noexcept
+    {
+        copy_from(m);
+        m.valid_.store(false, std::memory_order_relaxed);
+        return *this;
+    }
+
+    ~modifier() = default;
+
+    STRONG_NODISCARD
+    std::size_t hash() const
+    noexcept(noexcept(std::hash<T>{}(std::declval<const T&>())))
+    {
+        if (valid_.load(std::memory_order_acquire))
+        {
+            return hash_.load(std::memory_order_relaxed);
+        }
+        const std::size_t h = std::hash<T>{}(value_of(static_cast<const type&>(*this)));
+        hash_.store(h, std::memory_order_relaxed);
+        valid_.store(true, std::memory_order_release);
+        return h;
+    }
+
+    friend
+    void
+    strong_mutable_access(
+        type& t)
+    noexcept
+    {
+        static_cast<modifier&>(t).valid_.store(false, std::memory_order_relaxed);
+    }
+
+    // Values with different hashes differ. Hashes are only compared if both
+    // are already known, since computing them costs more than comparing.
+    // Only used by cached_hash_equal, since a stale hash would make equal
+    // values unequal.
+    friend
+    bool
+    strong_known_unequal(
+        const type& lh,
+        const type& rh)
+    noexcept
+    {
+        const auto& l = static_cast<const modifier&>(lh);
+        const auto& r = static_cast<const modifier&>(rh);
+        return l.valid_.load(std::memory_order_acquire)
+               && r.valid_.load(std::memory_order_acquire)
+               && l.hash_.load(std::memory_order_relaxed) != r.hash_.load(std::memory_order_relaxed);
+    }
+private:
+    void copy_from(const modifier& m) noexcept
+    {
+        const bool valid = m.valid_.load(std::memory_order_acquire);
+        hash_.store(m.hash_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        valid_.store(valid, std::memory_order_relaxed);
+    }
+
+    mutable std::atomic<std::size_t> hash_{0};
+    mutable std::atomic<bool> valid_{false};
+};
+
+// A KeyEqual for unordered containers of a type S with cached_hash, e.g.
+// std::unordered_set<S, std::hash<S>, strong::cached_hash_equal<S>>. Values
+// whose hashes are both known, and differ, are unequal without comparing the
+// values, which saves comparing long keys that share a bucket. Like the
+// lookup itself, this relies on the stored hashes not being stale.
+template <typename S>
+struct cached_hash_equal
+{
+    static_assert(type_is_v<S, cached_hash>, "cached_hash_equal is for types with strong::cached_hash");
+
+    STRONG_NODISCARD
+    bool operator()(const S& lh, const S& rh) const
+    noexcept(noexcept(value_of(lh) == value_of(rh)))
+    {
+        return !strong_known_unequal(lh, rh) && value_of(lh) == value_of(rh);
+    }
+};
+
+namespace impl
+{
+// The std::hash specialization for a strong type with cached_hash returns
+// the cached hash, which is std::hash of the underlying type.
+template <typename T>
+struct cached_std_hash : std::hash<T> {};
+
+template <typename Type>
+struct hasher_selector<Type, std::enable_if_t<type_is_v<Type, cached_hash>>>
+{
+    using type = cached_std_hash<underlying_type_t<Type>>;
+};
+
+template <typename Type, typename T>
+struct strong_hash<Type, cached_std_hash<T>> : std::hash<T>
+{
+    STRONG_NODISCARD
+    std::size_t
+    operator()(
+        const Type &t)
+    const
+    noexcept(noexcept(t.hash()))
+    {
+        return t.hash();
+    }
+};
+
+template <typename T, typename K>
+struct hasher_for<cached_std_hash<T>, K>
+{
+    using type = std::hash<K>;
+};
+}
+}
+
+#endif //STRONG_TYPE_CACHED_HASH_HPP
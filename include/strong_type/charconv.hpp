@@ -0,0 +1,133 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_CHARCONV_HPP
+#define STRONG_TYPE_CHARCONV_HPP
+
+#include "type.hpp"
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#define STRONG_TYPE_HAS_CHARCONV 1
+#endif
+#endif
+#ifndef STRONG_TYPE_HAS_CHARCONV
+#define STRONG_TYPE_HAS_CHARCONV 0
+#endif
+
+#if STRONG_TYPE_HAS_CHARCONV
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <charconv>
+#include <string_view>
+#include <system_error>
+#endif
+
+namespace strong
+{
+struct charconv
+{
+    template <typename T, typename = void>
+    class modifier
+    {
+        static_assert(impl::always_false<T>,
+                      "Underlying type must support std::to_chars and std::from_chars");
+    };
+};
+
+// to_chars() and from_chars() are found by argument dependent lookup, and
+// take the same extra arguments, e.g. a base or a std::chars_format, as
+// std::to_chars() and std::from_chars() do for the underlying type. Neither
+// allocates, nor uses the locale.
+template <typename T, typename Tag, typename ... M>
+class charconv::modifier<
+    ::strong::type<T, Tag, M...>,
+    impl::void_t<decltype(std::to_chars(std::declval<char*>(), std::declval<char*>(), std::declval<const T&>())),
+                 decltype(std::from_chars(std::declval<const char*>(), std::declval<const char*>(), std::declval<T&>()))>
+>
+{
+    using type = ::strong::type<T, Tag, M...>;
+public:
+    template <typename ... Args>
+    friend
+    auto
+    to_chars(
+        char* first,
+        char* last,
+        const type& t,
+        Args ... args)
+    -> decltype(std::to_chars(first, last, std::declval<const T&>(), args...))
+    {
+        return std::to_chars(first, last, value_of(t), args...);
+    }
+
+    // t is only changed if a value is parsed.
+    template <typename ... Args>
+    friend
+    auto
+    from_chars(
+        const char* first,
+        const char* last,
+        type& t,
+        Args ... args)
+    -> decltype(std::from_chars(first, last, std::declval<T&>(), args...))
+    {
+        T v{};
+        const auto r = std::from_chars(first, last, v, args...);
+        if (r.ec == std::errc{})
+        {
+            value_of(t) = v;
+        }
+        return r;
+    }
+};
+
+// The result of strong::parse<S>(). value is only meaningful when ec is
+// std::errc{}, which is also what the conversion to bool checks.
+template <typename S>
+struct parse_result
+{
+    S value;
+    const char* ptr;
+    std::errc ec;
+
+    STRONG_NODISCARD
+    explicit constexpr operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+namespace impl
+{
+template <typename S, typename>
+using parse_result_t = parse_result<S>;
+}
+
+// Parses all of s as an S, with from_chars() of the charconv modifier. Text
+// after the value is an error, std::errc::invalid_argument, with ptr where
+// it starts.
+template <typename S, typename ... Args>
+STRONG_NODISCARD
+auto parse(std::string_view s, Args ... args)
+-> impl::parse_result_t<S, decltype(from_chars(s.data(), s.data(), std::declval<S&>(), args...))>
+{
+    parse_result<S> r{S{underlying_type_t<S>{}}, s.data(), std::errc{}};
+    const auto last = s.data() + s.size();
+    const auto fc = from_chars(s.data(), last, r.value, args...);
+    r.ptr = fc.ptr;
+    r.ec = fc.ec == std::errc{} && fc.ptr != last ? std::errc::invalid_argument : fc.ec;
+    return r;
+}
+}
+
+#endif
+
+#endif //STRONG_TYPE_CHARCONV_HPP
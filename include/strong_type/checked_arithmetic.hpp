@@ -0,0 +1,285 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_CHECKED_ARITHMETIC_HPP
+#define STRONG_TYPE_CHECKED_ARITHMETIC_HPP
+
+#include "saturating_arithmetic.hpp"
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <cstdlib>
+#include <stdexcept>
+#endif
+
+namespace strong
+{
+// Overflow policies for checked_arithmetic. A policy has a static function
+//
+//   template <typename T> static T overflow(const char* operation, T wrapped);
+//
+// which is called when an operation overflows. wrapped is the result modulo
+// 2^N, and what overflow() returns, if it returns, is the result of the
+// operation.
+
+class overflow_error : public std::overflow_error
+{
+public:
+    using std::overflow_error::overflow_error;
+};
+
+// Throw strong::overflow_error, naming the operation.
+struct throw_on_overflow
+{
+    template <typename T>
+    [[noreturn]] static T overflow(const char* operation, T)
+    {
+        throw overflow_error(operation);
+    }
+};
+
+// Stop the program, without any unwinding.
+struct trap_on_overflow
+{
+    template <typename T>
+    [[noreturn]] static T overflow(const char*, T) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_trap();
+#else
+        std::abort();
+#endif
+    }
+};
+
+// Call Logger{}(operation), and carry on with the wrapped result.
+template <typename Logger>
+struct log_and_wrap_on_overflow
+{
+    template <typename T>
+    static T overflow(const char* operation, T wrapped)
+    {
+        Logger{}(operation);
+        return wrapped;
+    }
+};
+
+// Carry on with the wrapped result, and set a per thread flag that stays set
+// until cleared. Check it after a batch of calculations, instead of after
+// every operation.
+struct sticky_overflow
+{
+    template <typename T>
+    static T overflow(const char*, T wrapped) noexcept
+    {
+        flag() = true;
+        return wrapped;
+    }
+    STRONG_NODISCARD
+    static bool occurred() noexcept { return flag(); }
+    static void clear() noexcept { flag() = false; }
+private:
+    static bool& flag() noexcept
+    {
+        static thread_local bool f = false;
+        return f;
+    }
+};
+
+namespace impl
+{
+// r = a op b modulo 2^N, and return true if the real result does not fit.
+template <typename T>
+constexpr bool add_overflow(T a, T b, T& r) noexcept
+{
+#if STRONG_TYPE_HAS_OVERFLOW_BUILTINS
+    return __builtin_add_overflow(a, b, &r);
+#else
+    using U = std::make_unsigned_t<T>;
+    r = static_cast<T>(static_cast<U>(static_cast<U>(a) + static_cast<U>(b)));
+    return is_negative(b) ? r > a : r < a;
+#endif
+}
+
+template <typename T>
+constexpr bool sub_overflow(T a, T b, T& r) noexcept
+{
+#if STRONG_TYPE_HAS_OVERFLOW_BUILTINS
+    return __builtin_sub_overflow(a, b, &r);
+#else
+    using U = std::make_unsigned_t<T>;
+    r = static_cast<T>(static_cast<U>(static_cast<U>(a) - static_cast<U>(b)));
+    return is_negative(b) ? r < a : r > a;
+#endif
+}
+
+template <typename T>
+constexpr bool mul_overflow(T a, T b, T& r) noexcept
+{
+#if STRONG_TYPE_HAS_OVERFLOW_BUILTINS
+    return __builtin_mul_overflow(a, b, &r);
+#else
+    using U = std::make_unsigned_t<T>;
+    constexpr T min = std::numeric_limits<T>::min();
+    constexpr T max = std::numeric_limits<T>::max();
+    r = static_cast<T>(static_cast<U>(static_cast<unsigned long long>(static_cast<U>(a)) * static_cast<U>(b)));
+    if (a == 0 || b == 0) return false;
+    if (is_negative(a) == is_negative(b))
+    {
+        return is_negative(a) ? a < max / b : a > max / b;
+    }
+    return is_negative(a) ? a < min / b : b < min / a;
+#endif
+}
+}
+
+template <typename Policy>
+struct checked_arithmetic
+{
+    template <typename T, typename = void>
+    class modifier
+    {
+        static_assert(impl::always_false<T>,
+                      "Underlying type must be an integer type");
+    };
+};
+
+template <typename Policy>
+template <typename T, typename Tag, typename ... M>
+class checked_arithmetic<Policy>::modifier<::strong::type<T, Tag, M...>, impl::WhenSaturatingInteger<T>>
+{
+    using type = ::strong::type<T, Tag, M...>;
+public:
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator-(
+        const type &lh)
+    {
+        T r{};
+        return type{impl::sub_overflow(T{}, value_of(lh), r) ? Policy::overflow("-", r) : r};
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator+=(
+        type &lh,
+        const type &rh)
+    {
+        T r{};
+        value_of(lh) = impl::add_overflow(value_of(lh), value_of(rh), r) ? Policy::overflow("+", r) : r;
+        return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator-=(
+        type &lh,
+        const type &rh)
+    {
+        T r{};
+        value_of(lh) = impl::sub_overflow(value_of(lh), value_of(rh), r) ? Policy::overflow("-", r) : r;
+        return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator*=(
+        type &lh,
+        const type &rh)
+    {
+        T r{};
+        value_of(lh) = impl::mul_overflow(value_of(lh), value_of(rh), r) ? Policy::overflow("*", r) : r;
+        return lh;
+    }
+
+    // min / -1 overflows, and wraps to min. Division by zero is reported
+    // to the policy too, with 0 as the wrapped result.
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator/=(
+        type &lh,
+        const type &rh)
+    {
+        const T a = value_of(lh);
+        const T b = value_of(rh);
+        if (b == 0)
+        {
+            value_of(lh) = Policy::overflow("/ by zero", T{});
+        }
+        else if (impl::is_negative(b) && a == std::numeric_limits<T>::min() && b == static_cast<T>(-1))
+        {
+            value_of(lh) = Policy::overflow("/", a);
+        }
+        else
+        {
+            value_of(lh) = static_cast<T>(a / b);
+        }
+        return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator+(
+        type lh,
+        const type &rh)
+    {
+        lh += rh;
+        return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator-(
+        type lh,
+        const type &rh)
+    {
+        lh -= rh;
+        return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator*(
+        type lh,
+        const type &rh)
+    {
+        lh *= rh;
+        return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator/(
+        type lh,
+        const type &rh)
+    {
+        lh /= rh;
+        return lh;
+    }
+};
+}
+
+#endif //STRONG_TYPE_CHECKED_ARITHMETIC_HPP
@@ -0,0 +1,595 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_FLAT_MAP_HPP
+#define STRONG_TYPE_FLAT_MAP_HPP
+
+#include "type.hpp"
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#endif
+
+// Ordered associative containers stored in contiguous arrays, for keys that
+// are ordered, e.g. strong types with strong::ordered: flat_set<K> and
+// flat_map<K, V>. A flat_map stores the keys and the values in separate
+// arrays, so a search only touches keys. They are searched without
+// branching on the comparisons, so mispredictions do not cost anything, and
+// there are no pointers to chase.
+//
+// The Layout parameter chooses the order of the keys in the array.
+
+namespace strong
+{
+namespace layout
+{
+// The keys in sorted order. Iteration is in order, and elements can be
+// inserted and erased, at the cost of moving the elements after them.
+struct sorted {};
+
+// The keys in the breadth first order of a complete binary search tree,
+// known as the Eytzinger layout. The top levels of the tree, which every
+// search visits, share cache lines, and the nodes a search reaches a few
+// steps later are prefetched. For tables that are built once and then
+// searched a lot. Iteration is not in order, and elements cannot be inserted
+// or erased, only the whole table assigned.
+struct eytzinger {};
+}
+
+namespace impl
+{
+inline void prefetch(const void* p) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#else
+    static_cast<void>(p);
+#endif
+}
+
+inline unsigned trailing_ones(std::size_t v) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(~static_cast<unsigned long long>(v)));
+#else
+    unsigned r = 0;
+    while (v & 1U) { ++r; v >>= 1; }
+    return r;
+#endif
+}
+
+// How many levels below a node the search prefetches, as a number of
+// nodes, so that they fill a 64 byte cache line.
+constexpr std::size_t eytzinger_prefetch_nodes(std::size_t key_size, std::size_t n = 2)
+{
+    return n * 2 * key_size > 64 ? n : eytzinger_prefetch_nodes(key_size, n * 2);
+}
+
+template <typename Layout>
+struct flat_layout;
+
+template <>
+struct flat_layout<layout::sorted>
+{
+    template <typename T>
+    static std::vector<T> arrange(std::vector<T>&& sorted)
+    {
+        return std::move(sorted);
+    }
+
+    // The index of the first key for which before(key) is false, or n.
+    template <typename K, typename Before>
+    static std::size_t partition_point(const K* keys, std::size_t n, Before before)
+    {
+        if (n == 0) return 0;
+        std::size_t base = 0;
+        while (n > 1)
+        {
+            const std::size_t half = n / 2;
+            base += static_cast<std::size_t>(before(keys[base + half])) * half;
+            n -= half;
+        }
+        return base + static_cast<std::size_t>(before(keys[base]));
+    }
+};
+
+template <>
+struct flat_layout<layout::eytzinger>
+{
+    // Node k, counted from 1, is stored at index k - 1, and its children
+    // are nodes 2k and 2k + 1.
+    template <typename T>
+    static std::vector<T> arrange(std::vector<T>&& sorted)
+    {
+        std::vector<std::size_t> order(sorted.size());
+        std::size_t i = 0;
+        fill_order(order, i, 1);
+        std::vector<T> r;
+        r.reserve(sorted.size());
+        for (auto o : order)
+        {
+            r.push_back(std::move(sorted[o]));
+        }
+        return r;
+    }
+
+    template <typename K, typename Before>
+    static std::size_t partition_point(const K* keys, std::size_t n, Before before)
+    {
+        constexpr std::size_t ahead = eytzinger_prefetch_nodes(sizeof(K));
+        std::size_t k = 1;
+        while (k <= n)
+        {
+            if (ahead * k <= n) prefetch(keys + ahead * k - 1);
+            k = 2 * k + static_cast<std::size_t>(before(keys[k - 1]));
+        }
+        // The last step to the left was from the node searched for. Remove
+        // the steps to the right after it, and then it.
+        k >>= trailing_ones(k) + 1;
+        return k == 0 ? n : k - 1;
+    }
+private:
+    static void fill_order(std::vector<std::size_t>& order, std::size_t& i, std::size_t k)
+    {
+        if (k > order.size()) return;
+        fill_order(order, i, 2 * k);
+        order[k - 1] = i++;
+        fill_order(order, i, 2 * k + 1);
+    }
+};
+
+template <typename Layout>
+constexpr bool is_sorted_layout = std::is_same<Layout, layout::sorted>::value;
+
+template <typename Compare>
+struct flat_search
+{
+    template <typename Layout, typename K, typename KK>
+    static std::size_t lower_bound(const Compare& comp, const std::vector<K>& keys, const KK& k)
+    {
+        return flat_layout<Layout>::partition_point(keys.data(), keys.size(),
+                                                    [&](const K& e) { return comp(e, k); });
+    }
+
+    template <typename Layout, typename K, typename KK>
+    static std::size_t upper_bound(const Compare& comp, const std::vector<K>& keys, const KK& k)
+    {
+        return flat_layout<Layout>::partition_point(keys.data(), keys.size(),
+                                                    [&](const K& e) { return !comp(k, e); });
+    }
+
+    // The index of the key equivalent to k, or keys.size().
+    template <typename Layout, typename K, typename KK>
+    static std::size_t find(const Compare& comp, const std::vector<K>& keys, const KK& k)
+    {
+        const auto i = lower_bound<Layout>(comp, keys, k);
+        return i != keys.size() && !comp(k, keys[i]) ? i : keys.size();
+    }
+};
+
+// The ith element of two arrays, for flat_map. It refers to the arrays and
+// an index, not to the elements, so that the references are those of the
+// containers, which for std::vector<bool> are proxies.
+template <typename K, typename Values>
+class flat_map_iterator
+{
+    using value_reference = decltype(std::declval<Values&>()[0]);
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::pair<K, typename std::remove_const_t<Values>::value_type>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const K&, value_reference>;
+
+    class pointer
+    {
+    public:
+        explicit pointer(reference r) : r_(r) {}
+        const reference* operator->() const noexcept { return &r_; }
+    private:
+        reference r_;
+    };
+
+    flat_map_iterator() = default;
+    flat_map_iterator(const std::vector<K>* keys, Values* values, std::size_t i) noexcept
+        : keys_(keys), values_(values), i_(i) {}
+
+    template <typename VV, typename = std::enable_if_t<std::is_convertible<VV*, Values*>::value>>
+    flat_map_iterator(const flat_map_iterator<K, VV>& i) noexcept : keys_(i.keys_), values_(i.values_), i_(i.i_) {}
+
+    STRONG_NODISCARD
+    reference operator*() const noexcept { return {key(), value()}; }
+    STRONG_NODISCARD
+    pointer operator->() const noexcept { return pointer{**this}; }
+
+    STRONG_NODISCARD
+    const K& key() const noexcept { return (*keys_)[i_]; }
+    STRONG_NODISCARD
+    value_reference value() const noexcept { return (*values_)[i_]; }
+
+    flat_map_iterator& operator++() noexcept { ++i_; return *this; }
+    flat_map_iterator operator++(int) noexcept { auto r = *this; ++*this; return r; }
+    flat_map_iterator& operator--() noexcept { --i_; return *this; }
+    flat_map_iterator operator--(int) noexcept { auto r = *this; --*this; return r; }
+
+    STRONG_NODISCARD
+    friend bool operator==(const flat_map_iterator& lh, const flat_map_iterator& rh) noexcept { return lh.i_ == rh.i_; }
+    STRONG_NODISCARD
+    friend bool operator!=(const flat_map_iterator& lh, const flat_map_iterator& rh) noexcept { return lh.i_ != rh.i_; }
+private:
+    template <typename, typename>
+    friend class flat_map_iterator;
+
+    const std::vector<K>* keys_ = nullptr;
+    Values* values_ = nullptr;
+    std::size_t i_ = 0;
+};
+}
+
+template <typename K, typename Compare = std::less<K>, typename Layout = layout::sorted>
+class flat_set
+{
+    using search = impl::flat_search<Compare>;
+public:
+    using key_type = K;
+    using value_type = K;
+    using key_compare = Compare;
+    using layout_type = Layout;
+    using size_type = std::size_t;
+    using const_iterator = typename std::vector<K>::const_iterator;
+    using iterator = const_iterator;
+
+    flat_set() = default;
+    explicit flat_set(const Compare& comp) : comp_(comp) {}
+
+    template <typename It>
+    flat_set(It first, It last, const Compare& comp = Compare())
+        : comp_(comp)
+    {
+        assign(first, last);
+    }
+
+    flat_set(std::initializer_list<K> ks, const Compare& comp = Compare())
+        : flat_set(ks.begin(), ks.end(), comp)
+    {
+    }
+
+    // Replace the contents with [first, last). Of equivalent keys, the first
+    // is kept.
+    template <typename It>
+    void assign(It first, It last)
+    {
+        std::vector<K> ks(first, last);
+        std::stable_sort(ks.begin(), ks.end(), comp_);
+        ks.erase(std::unique(ks.begin(), ks.end(),
+                             [this](const K& lh, const K& rh) { return !comp_(lh, rh); }),
+                 ks.end());
+        keys_ = impl::flat_layout<Layout>::arrange(std::move(ks));
+    }
+
+    STRONG_NODISCARD
+    const_iterator find(const K& k) const { return make_iterator(index_of(k)); }
+    template <typename KK, typename C = Compare, typename = typename C::is_transparent>
+    STRONG_NODISCARD
+    const_iterator find(const KK& k) const { return make_iterator(index_of(k)); }
+
+    STRONG_NODISCARD
+    bool contains(const K& k) const { return index_of(k) != keys_.size(); }
+    template <typename KK, typename C = Compare, typename = typename C::is_transparent>
+    STRONG_NODISCARD
+    bool contains(const KK& k) const { return index_of(k) != keys_.size(); }
+
+    STRONG_NODISCARD
+    size_type count(const K& k) const { return contains(k) ? 1U : 0U; }
+    template <typename KK, typename C = Compare, typename = typename C::is_transparent>
+    STRONG_NODISCARD
+    size_type count(const KK& k) const { return contains(k) ? 1U : 0U; }
+
+    template <typename L = Layout>
+    STRONG_NODISCARD
+    const_iterator lower_bound(const K& k) const
+    {
+        static_assert(impl::is_sorted_layout<L>, "lower_bound() requires layout::sorted");
+        return make_iterator(search::template lower_bound<Layout>(comp_, keys_, k));
+    }
+
+    template <typename L = Layout>
+    STRONG_NODISCARD
+    const_iterator upper_bound(const K& k) const
+    {
+        static_assert(impl::is_sorted_layout<L>, "upper_bound() requires layout::sorted");
+        return make_iterator(search::template upper_bound<Layout>(comp_, keys_, k));
+    }
+
+    // Insert k, unless an equivalent key is already there.
+    template <typename L = Layout>
+    std::pair<iterator, bool> insert(K k)
+    {
+        static_assert(impl::is_sorted_layout<L>, "insert() requires layout::sorted");
+        const auto i = search::template lower_bound<Layout>(comp_, keys_, k);
+        if (i != keys_.size() && !comp_(k, keys_[i]))
+        {
+            return {make_iterator(i), false};
+        }
+        return {keys_.insert(make_iterator(i), std::move(k)), true};
+    }
+
+    template <typename L = Layout>
+    size_type erase(const K& k)
+    {
+        static_assert(impl::is_sorted_layout<L>, "erase() requires layout::sorted");
+        const auto i = index_of(k);
+        if (i == keys_.size()) return 0U;
+        keys_.erase(make_iterator(i));
+        return 1U;
+    }
+
+    void clear() noexcept { keys_.clear(); }
+    void reserve(size_type n) { keys_.reserve(n); }
+
+    STRONG_NODISCARD
+    size_type size() const noexcept { return keys_.size(); }
+    STRONG_NODISCARD
+    bool empty() const noexcept { return keys_.empty(); }
+    STRONG_NODISCARD
+    const_iterator begin() const noexcept { return keys_.begin(); }
+    STRONG_NODISCARD
+    const_iterator end() const noexcept { return keys_.end(); }
+
+    // The keys, in the order of Layout.
+    STRONG_NODISCARD
+    const std::vector<K>& keys() const noexcept { return keys_; }
+
+    STRONG_NODISCARD
+    friend bool operator==(const flat_set& lh, const flat_set& rh) { return lh.keys_ == rh.keys_; }
+    STRONG_NODISCARD
+    friend bool operator!=(const flat_set& lh, const flat_set& rh) { return lh.keys_ != rh.keys_; }
+private:
+    const_iterator make_iterator(size_type i) const noexcept
+    {
+        return keys_.begin() + static_cast<std::ptrdiff_t>(i);
+    }
+
+    template <typename KK>
+    size_type index_of(const KK& k) const
+    {
+        return search::template find<Layout>(comp_, keys_, k);
+    }
+
+    Compare comp_;
+    std::vector<K> keys_;
+};
+
+template <typename K, typename V, typename Compare = std::less<K>, typename Layout = layout::sorted>
+class flat_map
+{
+    using search = impl::flat_search<Compare>;
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using key_compare = Compare;
+    using layout_type = Layout;
+    using size_type = std::size_t;
+    using iterator = impl::flat_map_iterator<K, std::vector<V>>;
+    using const_iterator = impl::flat_map_iterator<K, const std::vector<V>>;
+    // V& and const V&, except for bool, where they are the proxies of
+    // std::vector<bool>.
+    using mapped_reference = typename std::vector<V>::reference;
+    using const_mapped_reference = typename std::vector<V>::const_reference;
+
+    flat_map() = default;
+    explicit flat_map(const Compare& comp) : comp_(comp) {}
+
+    template <typename It>
+    flat_map(It first, It last, const Compare& comp = Compare())
+        : comp_(comp)
+    {
+        assign(first, last);
+    }
+
+    flat_map(std::initializer_list<value_type> vs, const Compare& comp = Compare())
+        : flat_map(vs.begin(), vs.end(), comp)
+    {
+    }
+
+    // Replace the contents with the key/value pairs in [first, last). Of
+    // equivalent keys, the first is kept.
+    template <typename It>
+    void assign(It first, It last)
+    {
+        std::vector<value_type> vs(first, last);
+        std::stable_sort(vs.begin(), vs.end(),
+                         [this](const value_type& lh, const value_type& rh) { return comp_(lh.first, rh.first); });
+        vs.erase(std::unique(vs.begin(), vs.end(),
+                             [this](const value_type& lh, const value_type& rh) { return !comp_(lh.first, rh.first); }),
+                 vs.end());
+        std::vector<K> ks;
+        std::vector<V> values;
+        ks.reserve(vs.size());
+        values.reserve(vs.size());
+        for (auto& v : vs)
+        {
+            ks.push_back(std::move(v.first));
+            values.push_back(std::move(v.second));
+        }
+        keys_ = impl::flat_layout<Layout>::arrange(std::move(ks));
+        values_ = impl::flat_layout<Layout>::arrange(std::move(values));
+    }
+
+    STRONG_NODISCARD
+    iterator find(const K& k) { return make_iterator(index_of(k)); }
+    STRONG_NODISCARD
+    const_iterator find(const K& k) const { return make_iterator(index_of(k)); }
+    template <typename KK, typename C = Compare, typename = typename C::is_transparent>
+    STRONG_NODISCARD
+    iterator find(const KK& k) { return make_iterator(index_of(k)); }
+    template <typename KK, typename C = Compare, typename = typename C::is_transparent>
+    STRONG_NODISCARD
+    const_iterator find(const KK& k) const { return make_iterator(index_of(k)); }
+
+    STRONG_NODISCARD
+    bool contains(const K& k) const { return index_of(k) != keys_.size(); }
+    template <typename KK, typename C = Compare, typename = typename C::is_transparent>
+    STRONG_NODISCARD
+    bool contains(const KK& k) const { return index_of(k) != keys_.size(); }
+
+    STRONG_NODISCARD
+    size_type count(const K& k) const { return contains(k) ? 1U : 0U; }
+    template <typename KK, typename C = Compare, typename = typename C::is_transparent>
+    STRONG_NODISCARD
+    size_type count(const KK& k) const { return contains(k) ? 1U : 0U; }
+
+    STRONG_NODISCARD
+    mapped_reference at(const K& k) { return values_[checked_index_of(k)]; }
+    STRONG_NODISCARD
+    const_mapped_reference at(const K& k) const { return values_[checked_index_of(k)]; }
+    template <typename KK, typename C = Compare, typename = typename C::is_transparent>
+    STRONG_NODISCARD
+    mapped_reference at(const KK& k) { return values_[checked_index_of(k)]; }
+    template <typename KK, typename C = Compare, typename = typename C::is_transparent>
+    STRONG_NODISCARD
+    const_mapped_reference at(const KK& k) const { return values_[checked_index_of(k)]; }
+
+    template <typename L = Layout>
+    STRONG_NODISCARD
+    const_iterator lower_bound(const K& k) const
+    {
+        static_assert(impl::is_sorted_layout<L>, "lower_bound() requires layout::sorted");
+        return make_iterator(search::template lower_bound<Layout>(comp_, keys_, k));
+    }
+
+    template <typename L = Layout>
+    STRONG_NODISCARD
+    const_iterator upper_bound(const K& k) const
+    {
+        static_assert(impl::is_sorted_layout<L>, "upper_bound() requires layout::sorted");
+        return make_iterator(search::template upper_bound<Layout>(comp_, keys_, k));
+    }
+
+    // Insert k with value v, unless an equivalent key is already there.
+    template <typename L = Layout>
+    std::pair<iterator, bool> insert(K k, V v)
+    {
+        static_assert(impl::is_sorted_layout<L>, "insert() requires layout::sorted");
+        const auto i = search::template lower_bound<Layout>(comp_, keys_, k);
+        if (i != keys_.size() && !comp_(k, keys_[i]))
+        {
+            return {make_iterator(i), false};
+        }
+        insert_at(i, std::move(k), std::move(v));
+        return {make_iterator(i), true};
+    }
+
+    // The value of k, which is inserted with a value initialized V if it is
+    // not already there.
+    template <typename L = Layout>
+    mapped_reference operator[](const K& k)
+    {
+        static_assert(impl::is_sorted_layout<L>, "operator[] requires layout::sorted");
+        const auto i = search::template lower_bound<Layout>(comp_, keys_, k);
+        if (i == keys_.size() || comp_(k, keys_[i]))
+        {
+            insert_at(i, k, V{});
+        }
+        return values_[i];
+    }
+
+    template <typename L = Layout>
+    size_type erase(const K& k)
+    {
+        static_assert(impl::is_sorted_layout<L>, "erase() requires layout::sorted");
+        const auto i = index_of(k);
+        if (i == keys_.size()) return 0U;
+        keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(i));
+        values_.erase(values_.begin() + static_cast<std::ptrdiff_t>(i));
+        return 1U;
+    }
+
+    void clear() noexcept { keys_.clear(); values_.clear(); }
+    void reserve(size_type n) { keys_.reserve(n); values_.reserve(n); }
+
+    STRONG_NODISCARD
+    size_type size() const noexcept { return keys_.size(); }
+    STRONG_NODISCARD
+    bool empty() const noexcept { return keys_.empty(); }
+    STRONG_NODISCARD
+    iterator begin() noexcept { return make_iterator(0); }
+    STRONG_NODISCARD
+    iterator end() noexcept { return make_iterator(keys_.size()); }
+    STRONG_NODISCARD
+    const_iterator begin() const noexcept { return make_iterator(0); }
+    STRONG_NODISCARD
+    const_iterator end() const noexcept { return make_iterator(keys_.size()); }
+
+    // The keys and the values, in the order of Layout.
+    STRONG_NODISCARD
+    const std::vector<K>& keys() const noexcept { return keys_; }
+    STRONG_NODISCARD
+    const std::vector<V>& values() const noexcept { return values_; }
+
+    STRONG_NODISCARD
+    friend bool operator==(const flat_map& lh, const flat_map& rh)
+    {
+        return lh.keys_ == rh.keys_ && lh.values_ == rh.values_;
+    }
+    STRONG_NODISCARD
+    friend bool operator!=(const flat_map& lh, const flat_map& rh)
+    {
+        return !(lh == rh);
+    }
+private:
+    iterator make_iterator(size_type i) noexcept { return {&keys_, &values_, i}; }
+    const_iterator make_iterator(size_type i) const noexcept { return {&keys_, &values_, i}; }
+
+    void insert_at(size_type i, K k, V v)
+    {
+        values_.insert(values_.begin() + static_cast<std::ptrdiff_t>(i), std::move(v));
+        try
+        {
+            keys_.insert(keys_.begin() + static_cast<std::ptrdiff_t>(i), std::move(k));
+        }
+        catch (...)
+        {
+            values_.erase(values_.begin() + static_cast<std::ptrdiff_t>(i));
+            throw;
+        }
+    }
+
+    template <typename KK>
+    size_type index_of(const KK& k) const
+    {
+        return search::template find<Layout>(comp_, keys_, k);
+    }
+
+    template <typename KK>
+    size_type checked_index_of(const KK& k) const
+    {
+        const auto i = index_of(k);
+        if (i == keys_.size()) throw std::out_of_range("strong::flat_map::at");
+        return i;
+    }
+
+    Compare comp_;
+    std::vector<K> keys_;
+    std::vector<V> values_;
+};
+}
+
+#endif //STRONG_TYPE_FLAT_MAP_HPP
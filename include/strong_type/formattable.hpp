@@ -16,6 +16,12 @@
 
 #include "type.hpp"
 
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#endif
+
 #ifndef STRONG_HAS_STD_FORMAT
 #if __has_include(<version>)
 #include <version>
@@ -37,6 +43,22 @@
 #endif
 #endif
 
+// fmt::ostream_formatter, used for types that are ostreamable but not
+// formattable, drags in all of <ostream>. Define STRONG_HAS_FMT_OSTREAM to 0
+// to only support fmt for formattable types.
+#ifndef STRONG_HAS_FMT_OSTREAM
+#define STRONG_HAS_FMT_OSTREAM STRONG_HAS_FMT_FORMAT
+#endif
+
+// A type that is ostreamable but not formattable is formatted by fmt through
+// fmt::formatter of the underlying type, instead of by streaming it to a
+// std::ostream, if that gives the same text, i.e. if the underlying type is
+// an integer or a string. Define STRONG_FMT_DIRECT_OSTREAMABLE to 0 to
+// always stream.
+#ifndef STRONG_FMT_DIRECT_OSTREAMABLE
+#define STRONG_FMT_DIRECT_OSTREAMABLE 1
+#endif
+
 #if STRONG_HAS_STD_FORMAT
 #if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
 #include <format>
@@ -44,9 +66,11 @@
 #endif
 
 #if STRONG_HAS_FMT_FORMAT
-#include "ostreamable.hpp"
 #include <fmt/format.h>
+#if STRONG_HAS_FMT_OSTREAM
+#include "ostreamable.hpp"
 #include <fmt/ostream.h>
+#endif
 
 #endif
 
@@ -62,6 +86,102 @@ struct formattable
 template <typename T>
 using is_formattable = std::is_base_of<formattable::modifier<T>, T>;
 
+namespace impl
+{
+// An integer type that is formatted as a number, i.e. not bool nor a
+// character type.
+template <typename U>
+struct is_plain_integer
+    : std::integral_constant<bool,
+                             std::is_integral<U>::value
+                             && !std::is_same<U, bool>::value
+                             && !std::is_same<U, char>::value
+                             && !std::is_same<U, signed char>::value
+                             && !std::is_same<U, unsigned char>::value
+                             && !std::is_same<U, wchar_t>::value
+#if defined(__cpp_char8_t)
+                             && !std::is_same<U, char8_t>::value
+#endif
+                             && !std::is_same<U, char16_t>::value
+                             && !std::is_same<U, char32_t>::value>
+{
+};
+
+template <typename U>
+constexpr std::enable_if_t<std::is_signed<U>::value, bool> is_negative_integer(U u) noexcept { return u < 0; }
+template <typename U>
+constexpr std::enable_if_t<!std::is_signed<U>::value, bool> is_negative_integer(U) noexcept { return false; }
+
+// Room for the digits and the sign of any U.
+template <typename U>
+constexpr std::size_t max_decimal_chars = std::numeric_limits<U>::digits10 + 2;
+
+// Writes u in decimal, two digits at a time, backwards from last, and
+// returns where it starts.
+template <typename U>
+char* write_decimal(char* last, U u) noexcept
+{
+    using UU = std::make_unsigned_t<U>;
+    const bool negative = is_negative_integer(u);
+    UU v = negative ? static_cast<UU>(UU{0} - static_cast<UU>(u)) : static_cast<UU>(u);
+    const char* pairs =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    while (v >= 100)
+    {
+        const auto d = static_cast<std::size_t>(v % 100) * 2;
+        v = static_cast<UU>(v / 100);
+        *--last = pairs[d + 1];
+        *--last = pairs[d];
+    }
+    if (v >= 10)
+    {
+        const auto d = static_cast<std::size_t>(v) * 2;
+        *--last = pairs[d + 1];
+        *--last = pairs[d];
+    }
+    else
+    {
+        *--last = static_cast<char>('0' + v);
+    }
+    if (negative)
+    {
+        *--last = '-';
+    }
+    return last;
+}
+}
+
+template <typename OutputIt>
+struct format_to_n_result
+{
+    OutputIt out;
+    std::size_t size;
+};
+
+// Writes at most n characters of the formattable integer strong type s, as
+// "{}" would format it, to out. size is the number of characters of the
+// whole value, like for fmt::format_to_n() and std::format_to_n(). It needs
+// neither a format string nor a formatting library.
+template <typename OutputIt, typename S>
+auto
+format_to_n(
+    OutputIt out,
+    std::size_t n,
+    const S& s)
+-> std::enable_if_t<is_formattable<S>::value && impl::is_plain_integer<underlying_type_t<S>>::value,
+                    format_to_n_result<OutputIt>>
+{
+    using U = underlying_type_t<S>;
+    char buf[impl::max_decimal_chars<U>];
+    char* const last = buf + sizeof(buf);
+    const char* const first = impl::write_decimal(last, value_of(s));
+    const auto size = static_cast<std::size_t>(last - first);
+    out = std::copy(first, first + (n < size ? n : size), out);
+    return {out, size};
+}
+
 }
 
 
@@ -102,29 +222,109 @@ namespace strong {
 template <typename T, typename Char>
 struct formatter;
 
+namespace impl
+{
+template <typename T, typename Char, bool = is_plain_integer<T>::value && std::is_same<Char, char>::value>
+struct fmt_underlying_formatter : fmt::formatter<T, Char>
+{
+  template<typename FormatContext>
+  STRONG_CONSTEXPR
+  decltype(auto)
+  format_underlying(const T& t, FormatContext& fc) const
+  {
+    return fmt::formatter<T, Char>::format(t, fc);
+  }
+
+  template<typename FormatContext>
+  STRONG_CONSTEXPR
+  decltype(auto)
+  format_underlying(const T& t, FormatContext& fc)
+  {
+    return fmt::formatter<T, Char>::format(t, fc);
+  }
+};
+
+// An integer formatted with an empty format spec, "{}", is written directly,
+// without the formatter of the integer, which handles all specs at run time.
+// fmt does not call parse() for "{}" compiled with FMT_COMPILE, so the spec
+// is empty unless parse() says otherwise.
+template <typename T, typename Char>
+struct fmt_underlying_formatter<T, Char, true> : fmt::formatter<T, Char>
+{
+  template<typename ParseContext>
+  constexpr
+  auto
+  parse(ParseContext& pc)
+  -> decltype(pc.begin())
+  {
+    empty_spec_ = pc.begin() == pc.end() || *pc.begin() == '}';
+    return fmt::formatter<T, Char>::parse(pc);
+  }
+
+  template<typename FormatContext>
+  decltype(auto)
+  format_underlying(const T& t, FormatContext& fc) const
+  {
+    if (!empty_spec_)
+    {
+      return fmt::formatter<T, Char>::format(t, fc);
+    }
+    char buf[max_decimal_chars<T>];
+    char* const last = buf + sizeof(buf);
+    const char* const first = write_decimal(last, t);
+    const fmt::string_view digits(first, static_cast<std::size_t>(last - first));
+    return fmt::formatter<fmt::string_view, char>{}.format(digits, fc);
+  }
+
+  template<typename FormatContext>
+  decltype(auto)
+  format_underlying(const T& t, FormatContext& fc)
+  {
+    return static_cast<const fmt_underlying_formatter&>(*this).format_underlying(t, fc);
+  }
+
+  bool empty_spec_ = true;
+};
+}
+
 template <typename T, typename Tag, typename ... M, typename Char>
-struct formatter<type<T, Tag, M...>, Char> : fmt::formatter<T, Char>
+struct formatter<type<T, Tag, M...>, Char> : impl::fmt_underlying_formatter<T, Char>
 {
   template<typename FormatContext, typename Type>
   STRONG_CONSTEXPR
   decltype(auto)
   format(const Type& t, FormatContext& fc) const
-      noexcept(noexcept(std::declval<fmt::formatter<T, Char>>().format(std::declval<const T&>(), fc)))
   {
-    return fmt::formatter<T, Char>::format(value_of(t), fc);
+    return impl::fmt_underlying_formatter<T, Char>::format_underlying(value_of(t), fc);
   }
 
   template<typename FormatContext, typename Type>
   STRONG_CONSTEXPR
   decltype(auto)
   format(const Type& t, FormatContext& fc)
-      noexcept(noexcept(std::declval<fmt::formatter<T, Char>>().format(std::declval<const T&>(), fc)))
   {
-    return fmt::formatter<T, Char>::format(value_of(t), fc);
+    return impl::fmt_underlying_formatter<T, Char>::format_underlying(value_of(t), fc);
   }
 };
 
-#if FMT_VERSION >= 90000
+#if FMT_VERSION >= 90000 && STRONG_HAS_FMT_OSTREAM
+
+namespace impl
+{
+// fmt formats U like std::ostream does by default. Not for floating point
+// types, which fmt prints with all digits and a stream with 6, nor for bool
+// and character types, which print differently.
+template <typename U, typename Char, typename = void>
+struct formats_like_stream : is_plain_integer<U> {};
+
+template <typename Char, typename Traits, typename Alloc>
+struct formats_like_stream<std::basic_string<Char, Traits, Alloc>, Char> : std::true_type {};
+
+#if __cplusplus >= 201703L
+template <typename Char, typename Traits>
+struct formats_like_stream<std::basic_string_view<Char, Traits>, Char> : std::true_type {};
+#endif
+}
 
 template <typename T, typename Char, bool = is_formattable<T>::value>
 struct select_formatter;
@@ -138,14 +338,17 @@ struct select_formatter<T, Char, true>
 template <typename T, typename Char>
 struct select_formatter<T, Char, false>
 {
-  using type = fmt::ostream_formatter;
+  using type = std::conditional_t<STRONG_FMT_DIRECT_OSTREAMABLE
+                                  && impl::formats_like_stream<underlying_type_t<T>, Char>::value,
+                                  formatter<T, Char>,
+                                  fmt::ostream_formatter>;
 };
 
 #endif
 }
 namespace fmt
 {
-#if FMT_VERSION >= 90000
+#if FMT_VERSION >= 90000 && STRONG_HAS_FMT_OSTREAM
 template <typename T, typename Tag, typename ... M, typename Char>
 struct formatter<::strong::type<T, Tag, M...>,
                  Char,
@@ -0,0 +1,91 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_FWD_HPP
+#define STRONG_TYPE_FWD_HPP
+
+// Declarations only, with no includes at all. Enough to name strong types,
+// e.g. in function declarations and class members held by pointer or
+// reference, without paying for the headers that define them.
+//
+// value_of() is a hidden friend of strong::type, found by argument dependent
+// lookup, so it has no declaration here. Calling it requires the definition
+// of the type anyway.
+
+namespace strong
+{
+struct uninitialized_t;
+
+template <typename T, typename Tag, typename ... M>
+class type;
+
+template <typename D = void>
+struct affine_point;
+struct arithmetic;
+struct bicrementable;
+struct bitarithmetic;
+struct boolean;
+struct cached_hash;
+struct charconv;
+struct throw_on_overflow;
+template <typename Policy = throw_on_overflow>
+struct checked_arithmetic;
+template <typename ... Ts>
+struct convertible_to;
+struct decrementable;
+struct default_constructible;
+struct default_uninitialized;
+struct difference;
+namespace endian
+{
+struct little;
+struct big;
+}
+struct equality;
+template <typename ... Ts>
+struct equality_with;
+struct formattable;
+struct hashable;
+template <typename Hasher>
+struct hashable_with;
+template <typename ... Ts>
+struct implicitly_convertible_to;
+struct incrementable;
+namespace bounds
+{
+struct unchecked;
+}
+template <typename I = void, typename Policy = bounds::unchecked>
+struct indexed;
+struct invocable;
+struct iostreamable;
+struct istreamable;
+class iterator;
+struct ordered;
+template <typename ... Ts>
+struct ordered_with;
+struct ostreamable;
+struct pointer;
+class range;
+struct regular;
+struct saturating_arithmetic;
+template <typename ... Ts>
+struct scalable_with;
+struct semiregular;
+template <typename Endian>
+struct serializable;
+struct unique;
+struct wrapping_arithmetic;
+}
+
+#endif //STRONG_TYPE_FWD_HPP
@@ -17,6 +17,7 @@
 #include "type.hpp"
 
 #if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <cstdint>
 #include <functional>
 #endif
 
@@ -28,34 +29,171 @@ struct hashable
     class modifier{};
 };
 
+// Hash the underlying value with Hasher instead of std::hash. Hasher is
+// default constructible, and callable with a const reference to the
+// underlying value, returning std::size_t.
+namespace impl
+{
+template <typename Hasher>
+struct hasher_is {};
+
+// Whether more than one of hashable and hashable_with<H> is listed.
+template <typename T>
+struct has_several_hash_modifiers;
 }
 
-namespace std {
-template<typename T, typename Tag, typename ... M>
-struct hash<::strong::type<T, Tag, M...>>
-    : std::conditional_t<
-        std::is_base_of<
-            ::strong::hashable::modifier<
-                ::strong::type<T, Tag, M...>
-            >,
-            ::strong::type<T, Tag, M...>
-        >::value,
-        hash<T>,
-        std::false_type>
-{
-    using type = ::strong::type<T, Tag, M...>;
+template <typename Hasher>
+struct hashable_with
+{
+    template <typename T>
+    class modifier : public impl::hasher_is<Hasher>
+    {
+        static_assert(!impl::has_several_hash_modifiers<T>::value,
+                      "Use only one of hashable and hashable_with<H>");
+    };
+};
+
+namespace impl
+{
+template <typename M>
+struct is_hash_modifier : std::false_type {};
+template <>
+struct is_hash_modifier<hashable> : std::true_type {};
+template <typename H>
+struct is_hash_modifier<hashable_with<H>> : std::true_type {};
+
+template <typename ... M>
+struct has_hash_modifier : std::false_type {};
+template <typename M, typename ... Ms>
+struct has_hash_modifier<M, Ms...>
+    : std::integral_constant<bool, is_hash_modifier<M>::value || has_hash_modifier<Ms...>::value> {};
+
+template <typename ... M>
+struct has_several_hash_modifiers_in : std::false_type {};
+template <typename M, typename ... Ms>
+struct has_several_hash_modifiers_in<M, Ms...>
+    : std::integral_constant<bool, is_hash_modifier<M>::value
+                                   ? has_hash_modifier<Ms...>::value
+                                   : has_several_hash_modifiers_in<Ms...>::value> {};
+
+template <typename T>
+struct has_several_hash_modifiers : std::false_type {};
+template <typename T, typename Tag, typename ... M>
+struct has_several_hash_modifiers<type<T, Tag, M...>> : has_several_hash_modifiers_in<M...> {};
+}
 
+namespace impl
+{
+constexpr std::uint64_t fmix64(std::uint64_t h) noexcept
+{
+    h ^= h >> 33U;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33U;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33U;
+    return h;
+}
+
+// The 128 bit product of a and b, folded to 64 bits by xor of the halves.
+constexpr std::uint64_t folded_multiply(std::uint64_t a, std::uint64_t b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 u128;
+    const u128 r = static_cast<u128>(a) * b;
+    return static_cast<std::uint64_t>(r) ^ static_cast<std::uint64_t>(r >> 64U);
+#else
+    const std::uint64_t a_lo = a & 0xffffffffU;
+    const std::uint64_t a_hi = a >> 32U;
+    const std::uint64_t b_lo = b & 0xffffffffU;
+    const std::uint64_t b_hi = b >> 32U;
+    const std::uint64_t lo_lo = a_lo * b_lo;
+    const std::uint64_t hi_lo = a_hi * b_lo;
+    const std::uint64_t lo_hi = a_lo * b_hi;
+    const std::uint64_t hi_hi = a_hi * b_hi;
+    const std::uint64_t cross = (lo_lo >> 32U) + (hi_lo & 0xffffffffU) + lo_hi;
+    const std::uint64_t hi = hi_hi + (hi_lo >> 32U) + (cross >> 32U);
+    const std::uint64_t lo = (cross << 32U) | (lo_lo & 0xffffffffU);
+    return hi ^ lo;
+#endif
+}
+}
+
+// Hashers for hashable_with. They hash the value with std::hash, and mix the
+// bits of the result, so that all bits depend on all input bits. For
+// integers, std::hash is often the identity, and sequential values then
+// end up in sequential buckets, or in the same bucket in tables that use
+// the low bits of the hash.
+
+// The finalizer of MurmurHash3.
+struct murmur_mix_hash
+{
+    template <typename T>
+    STRONG_NODISCARD
+    std::size_t operator()(const T& t) const noexcept(noexcept(std::hash<T>{}(t)))
+    {
+        return static_cast<std::size_t>(impl::fmix64(std::hash<T>{}(t)));
+    }
+};
+
+// A single 64x64->128 bit multiplication, folded, as in wyhash. Faster than
+// murmur_mix_hash where the multiplication is a single instruction.
+struct folded_multiply_hash
+{
+    template <typename T>
+    STRONG_NODISCARD
+    std::size_t operator()(const T& t) const noexcept(noexcept(std::hash<T>{}(t)))
+    {
+        return static_cast<std::size_t>(impl::folded_multiply(std::hash<T>{}(t) ^ 0xa0761d6478bd642fULL,
+                                                              0xe7037ed1a0b428dbULL));
+    }
+};
+
+namespace impl
+{
+template <typename T, typename Tag, typename ... M>
+std::hash<T> hasher_of(const hashable::modifier<type<T, Tag, M...>>*);
+
+template <typename H>
+H hasher_of(const hasher_is<H>*);
+
+std::false_type hasher_of(const void*);
+
+// The hasher of a strong type, or std::false_type if it is not hashable.
+// Other headers specialize it for modifiers that provide std::hash, since
+// an overload of hasher_of() declared after this point is not found.
+template <typename Type, typename = void>
+struct hasher_selector
+{
+    using type = decltype(hasher_of(static_cast<const Type*>(nullptr)));
+};
+
+template <typename Type>
+using hasher_t = typename hasher_selector<Type>::type;
+
+template <typename Type, typename H = hasher_t<Type>>
+struct strong_hash : H
+{
     STRONG_NODISCARD
     decltype(auto)
     operator()(
-        const ::strong::hashable::modifier<type> &t)
+        const Type &t)
     const
-    noexcept(noexcept(std::declval<hash<T>>()(
-        value_of(std::declval<const type &>()))))
+    noexcept(noexcept(std::declval<const H&>()(value_of(t))))
     {
-        auto &tt = static_cast<const type &>(t);
-        return hash<T>::operator()(value_of(tt));
+        return H::operator()(value_of(t));
     }
 };
+
+template <typename Type>
+struct strong_hash<Type, std::false_type> : std::false_type {};
+}
+}
+
+namespace std {
+template<typename T, typename Tag, typename ... M>
+struct hash<::strong::type<T, Tag, M...>>
+    : ::strong::impl::strong_hash<::strong::type<T, Tag, M...>>
+{
+};
 }
 #endif //STRONG_TYPE_HASHABLE_HPP
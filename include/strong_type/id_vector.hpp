@@ -0,0 +1,346 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_ID_VECTOR_HPP
+#define STRONG_TYPE_ID_VECTOR_HPP
+
+#include "type.hpp"
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#endif
+
+// Dense containers indexed by a strong id type, for ids that are handed out
+// in sequence from 0: id_vector<Id, V>, id_span<Id, V> and
+// id_array<Id, V, N>. They are indexed only by Id, and hand out Id values,
+// e.g. from push_back(), so an id of one kind cannot be used to index a
+// container of another. Lookup is an array access, with no hashing.
+
+namespace strong
+{
+namespace impl
+{
+template <typename Id>
+struct id_index
+{
+    using U = underlying_type_t<Id>;
+    static_assert(is_strong_type<Id>::value, "Id must be a strong::type");
+    static_assert(std::is_integral<U>::value, "The underlying type of Id must be an integer type");
+
+    // How many ids there are, i.e. how many values an id can index, capped at
+    // what a std::size_t can count.
+    static constexpr std::size_t id_count
+        = static_cast<std::make_unsigned_t<U>>(std::numeric_limits<U>::max()) >= std::numeric_limits<std::size_t>::max()
+          ? std::numeric_limits<std::size_t>::max()
+          : static_cast<std::size_t>(std::numeric_limits<U>::max()) + 1;
+
+    static constexpr std::size_t to_index(const Id& id) noexcept
+    {
+        return static_cast<std::size_t>(value_of(id));
+    }
+
+    static constexpr Id to_id(std::size_t i) noexcept
+    {
+        return Id{static_cast<U>(i)};
+    }
+};
+}
+
+// The ids [first, last), in order.
+template <typename Id>
+class id_range
+{
+public:
+    class iterator
+    {
+    public:
+        // operator* returns the id by value, which a legacy forward
+        // iterator may not do, but a C++20 forward_iterator may.
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = Id;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Id;
+
+        constexpr iterator() noexcept = default;
+        constexpr explicit iterator(std::size_t i) noexcept : i_(i) {}
+
+        STRONG_NODISCARD
+        constexpr Id operator*() const noexcept { return impl::id_index<Id>::to_id(i_); }
+
+        constexpr iterator& operator++() noexcept { ++i_; return *this; }
+        constexpr iterator operator++(int) noexcept { auto r = *this; ++i_; return r; }
+
+        STRONG_NODISCARD
+        friend constexpr bool operator==(const iterator& lh, const iterator& rh) noexcept { return lh.i_ == rh.i_; }
+        STRONG_NODISCARD
+        friend constexpr bool operator!=(const iterator& lh, const iterator& rh) noexcept { return lh.i_ != rh.i_; }
+    private:
+        std::size_t i_ = 0;
+    };
+
+    constexpr id_range(std::size_t first, std::size_t last) noexcept : first_(first), last_(last) {}
+
+    STRONG_NODISCARD
+    constexpr iterator begin() const noexcept { return iterator{first_}; }
+    STRONG_NODISCARD
+    constexpr iterator end() const noexcept { return iterator{last_}; }
+    STRONG_NODISCARD
+    constexpr std::size_t size() const noexcept { return last_ - first_; }
+    STRONG_NODISCARD
+    constexpr bool empty() const noexcept { return first_ == last_; }
+private:
+    std::size_t first_;
+    std::size_t last_;
+};
+
+// A view of contiguous values indexed by Id.
+template <typename Id, typename V>
+class id_span
+{
+    using index = impl::id_index<Id>;
+public:
+    using id_type = Id;
+    using value_type = std::remove_cv_t<V>;
+    using size_type = std::size_t;
+    using reference = V&;
+    using iterator = V*;
+
+    constexpr id_span() noexcept = default;
+    constexpr id_span(V* data, size_type size) noexcept : data_(data), size_(size) {}
+
+    // A span of const values from a span of non-const values.
+    template <typename VV, typename = std::enable_if_t<std::is_convertible<VV(*)[], V(*)[]>::value>>
+    constexpr id_span(id_span<Id, VV> s) noexcept : data_(s.data()), size_(s.size()) {}
+
+    STRONG_NODISCARD
+    constexpr V& operator[](const Id& id) const noexcept { return data_[index::to_index(id)]; }
+
+    STRONG_NODISCARD
+    constexpr bool contains(const Id& id) const noexcept { return index::to_index(id) < size_; }
+
+    STRONG_NODISCARD
+    constexpr size_type size() const noexcept { return size_; }
+    STRONG_NODISCARD
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    STRONG_NODISCARD
+    constexpr V* data() const noexcept { return data_; }
+    STRONG_NODISCARD
+    constexpr iterator begin() const noexcept { return data_; }
+    STRONG_NODISCARD
+    constexpr iterator end() const noexcept { return data_ + size_; }
+
+    // The ids of the values, in order.
+    STRONG_NODISCARD
+    constexpr id_range<Id> ids() const noexcept { return {0, size_}; }
+private:
+    V* data_ = nullptr;
+    size_type size_ = 0;
+};
+
+// A std::vector<V> indexed by Id. Adding more values than there are ids,
+// e.g. more than 256 with an 8 bit Id, throws std::length_error, instead of
+// handing out an id again.
+template <typename Id, typename V, typename Allocator = std::allocator<V>>
+class id_vector
+{
+    using index = impl::id_index<Id>;
+    static_assert(!std::is_same<V, bool>::value,
+                  "std::vector<bool> has no data() to view, use e.g. id_vector<Id, char>");
+public:
+    using id_type = Id;
+    using underlying_type = std::vector<V, Allocator>;
+    using value_type = V;
+    using allocator_type = Allocator;
+    using size_type = typename underlying_type::size_type;
+    using reference = typename underlying_type::reference;
+    using const_reference = typename underlying_type::const_reference;
+    using iterator = typename underlying_type::iterator;
+    using const_iterator = typename underlying_type::const_iterator;
+
+    id_vector() = default;
+    explicit id_vector(const Allocator& a) : values_(a) {}
+    explicit id_vector(size_type n, const Allocator& a = Allocator()) : values_(checked_size(n), a) {}
+    id_vector(size_type n, const V& v, const Allocator& a = Allocator()) : values_(checked_size(n), v, a) {}
+    id_vector(std::initializer_list<V> vs, const Allocator& a = Allocator()) : values_(vs, a) { check_room(vs.size()); }
+
+    STRONG_NODISCARD
+    reference operator[](const Id& id) noexcept { return values_[index::to_index(id)]; }
+    STRONG_NODISCARD
+    const_reference operator[](const Id& id) const noexcept { return values_[index::to_index(id)]; }
+
+    STRONG_NODISCARD
+    reference at(const Id& id) { check(id); return values_[index::to_index(id)]; }
+    STRONG_NODISCARD
+    const_reference at(const Id& id) const { check(id); return values_[index::to_index(id)]; }
+
+    STRONG_NODISCARD
+    bool contains(const Id& id) const noexcept { return index::to_index(id) < values_.size(); }
+
+    // Add a value, and return its id.
+    Id push_back(const V& v) { check_room(values_.size() + 1); values_.push_back(v); return last_id(); }
+    Id push_back(V&& v) { check_room(values_.size() + 1); values_.push_back(std::move(v)); return last_id(); }
+    template <typename ... Args>
+    Id emplace_back(Args&& ... args)
+    {
+        check_room(values_.size() + 1);
+        values_.emplace_back(std::forward<Args>(args)...);
+        return last_id();
+    }
+    void pop_back() { values_.pop_back(); }
+
+    // The id the next value added will get. Throws std::length_error if all
+    // ids are taken.
+    STRONG_NODISCARD
+    Id next_id() const { check_room(values_.size() + 1); return index::to_id(values_.size()); }
+
+    STRONG_NODISCARD
+    size_type size() const noexcept { return values_.size(); }
+    STRONG_NODISCARD
+    bool empty() const noexcept { return values_.empty(); }
+    STRONG_NODISCARD
+    size_type max_size() const noexcept
+    {
+        return values_.max_size() < index::id_count ? values_.max_size() : index::id_count;
+    }
+    STRONG_NODISCARD
+    size_type capacity() const noexcept { return values_.capacity(); }
+    void reserve(size_type n) { check_room(n); values_.reserve(n); }
+    void resize(size_type n) { check_room(n); values_.resize(n); }
+    void resize(size_type n, const V& v) { check_room(n); values_.resize(n, v); }
+    void clear() noexcept { values_.clear(); }
+
+    STRONG_NODISCARD
+    V* data() noexcept { return values_.data(); }
+    STRONG_NODISCARD
+    const V* data() const noexcept { return values_.data(); }
+    STRONG_NODISCARD
+    reference front() { return values_.front(); }
+    STRONG_NODISCARD
+    const_reference front() const { return values_.front(); }
+    STRONG_NODISCARD
+    reference back() { return values_.back(); }
+    STRONG_NODISCARD
+    const_reference back() const { return values_.back(); }
+
+    STRONG_NODISCARD
+    iterator begin() noexcept { return values_.begin(); }
+    STRONG_NODISCARD
+    iterator end() noexcept { return values_.end(); }
+    STRONG_NODISCARD
+    const_iterator begin() const noexcept { return values_.begin(); }
+    STRONG_NODISCARD
+    const_iterator end() const noexcept { return values_.end(); }
+    STRONG_NODISCARD
+    const_iterator cbegin() const noexcept { return values_.cbegin(); }
+    STRONG_NODISCARD
+    const_iterator cend() const noexcept { return values_.cend(); }
+
+    // The ids of the values, in order.
+    STRONG_NODISCARD
+    id_range<Id> ids() const noexcept { return {0, values_.size()}; }
+
+    STRONG_NODISCARD
+    operator id_span<Id, V>() noexcept { return {values_.data(), values_.size()}; }
+    STRONG_NODISCARD
+    operator id_span<Id, const V>() const noexcept { return {values_.data(), values_.size()}; }
+
+    STRONG_NODISCARD
+    friend bool operator==(const id_vector& lh, const id_vector& rh) { return lh.values_ == rh.values_; }
+    STRONG_NODISCARD
+    friend bool operator!=(const id_vector& lh, const id_vector& rh) { return lh.values_ != rh.values_; }
+
+    STRONG_NODISCARD
+    friend underlying_type& value_of(id_vector& v) noexcept { return v.values_; }
+    STRONG_NODISCARD
+    friend const underlying_type& value_of(const id_vector& v) noexcept { return v.values_; }
+private:
+    Id last_id() const noexcept { return index::to_id(values_.size() - 1); }
+    void check(const Id& id) const
+    {
+        if (!contains(id)) throw std::out_of_range("strong::id_vector::at");
+    }
+    static void check_room(size_type n)
+    {
+        if (n > index::id_count) throw std::length_error("strong::id_vector: more values than ids");
+    }
+    static size_type checked_size(size_type n) { check_room(n); return n; }
+
+    underlying_type values_;
+};
+
+// A std::array<V, N> indexed by Id. An aggregate, like std::array.
+template <typename Id, typename V, std::size_t N>
+struct id_array
+{
+    static_assert(N <= impl::id_index<Id>::id_count, "More values than ids");
+
+    using id_type = Id;
+    using underlying_type = std::array<V, N>;
+    using value_type = V;
+    using size_type = std::size_t;
+    using iterator = typename underlying_type::iterator;
+    using const_iterator = typename underlying_type::const_iterator;
+
+    STRONG_NODISCARD
+    STRONG_CONSTEXPR V& operator[](const Id& id) noexcept { return _values[impl::id_index<Id>::to_index(id)]; }
+    STRONG_NODISCARD
+    constexpr const V& operator[](const Id& id) const noexcept { return _values[impl::id_index<Id>::to_index(id)]; }
+
+    STRONG_NODISCARD
+    constexpr bool contains(const Id& id) const noexcept { return impl::id_index<Id>::to_index(id) < N; }
+
+    STRONG_NODISCARD
+    static constexpr size_type size() noexcept { return N; }
+    STRONG_NODISCARD
+    static constexpr bool empty() noexcept { return N == 0; }
+
+    STRONG_NODISCARD
+    STRONG_CONSTEXPR V* data() noexcept { return _values.data(); }
+    STRONG_NODISCARD
+    constexpr const V* data() const noexcept { return _values.data(); }
+    STRONG_NODISCARD
+    STRONG_CONSTEXPR iterator begin() noexcept { return _values.begin(); }
+    STRONG_NODISCARD
+    STRONG_CONSTEXPR iterator end() noexcept { return _values.end(); }
+    STRONG_NODISCARD
+    constexpr const_iterator begin() const noexcept { return _values.begin(); }
+    STRONG_NODISCARD
+    constexpr const_iterator end() const noexcept { return _values.end(); }
+
+    // The ids of the values, in order.
+    STRONG_NODISCARD
+    static constexpr id_range<Id> ids() noexcept { return {0, N}; }
+
+    STRONG_NODISCARD
+    operator id_span<Id, V>() noexcept { return {_values.data(), N}; }
+    STRONG_NODISCARD
+    operator id_span<Id, const V>() const noexcept { return {_values.data(), N}; }
+
+    STRONG_NODISCARD
+    friend constexpr underlying_type& value_of(id_array& a) noexcept { return a._values; }
+    STRONG_NODISCARD
+    friend constexpr const underlying_type& value_of(const id_array& a) noexcept { return a._values; }
+
+    underlying_type _values;
+};
+}
+
+#endif //STRONG_TYPE_ID_VECTOR_HPP
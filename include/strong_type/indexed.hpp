@@ -16,9 +16,133 @@
 
 #include "type.hpp"
 
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <cstddef>
+#include <cstdlib>
+#include <stdexcept>
+#endif
+
+// STRONG_ASSUME(condition) tells the optimizer that condition is true, without
+// checking it. If it is false, the behaviour is undefined.
+#ifndef STRONG_ASSUME
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(assume) >= 202207L
+#define STRONG_ASSUME(condition) [[assume(condition)]]
+#endif
+#endif
+#endif
+#ifndef STRONG_ASSUME
+#if defined(__clang__)
+#define STRONG_ASSUME(condition) __builtin_assume(condition)
+#elif defined(__GNUC__) && __GNUC__ >= 13
+#define STRONG_ASSUME(condition) __attribute__((assume(condition)))
+#elif defined(_MSC_VER)
+#define STRONG_ASSUME(condition) __assume(condition)
+#else
+// Older gcc has only `if (!(condition)) __builtin_unreachable()`, which
+// leaves a branch in loops that stops them from being vectorized, so
+// nothing is better.
+#define STRONG_ASSUME(condition) static_cast<void>(sizeof(!(condition)))
+#endif
+#endif
+
 namespace strong
 {
-template <typename I = void>
+namespace impl
+{
+template <typename C>
+constexpr auto container_size(const C& c) noexcept(noexcept(c.size())) -> decltype(c.size())
+{
+    return c.size();
+}
+
+template <typename E, std::size_t N>
+constexpr std::size_t container_size(const E(&)[N]) noexcept
+{
+    return N;
+}
+
+template <typename I>
+constexpr std::enable_if_t<std::is_signed<I>::value, bool> index_is_negative(I i) noexcept { return i < 0; }
+template <typename I>
+constexpr std::enable_if_t<!std::is_signed<I>::value, bool> index_is_negative(I) noexcept { return false; }
+
+template <typename C, typename I>
+constexpr bool index_in_bounds(const C& c, const I& i) noexcept(noexcept(container_size(c)))
+{
+    static_assert(std::is_integral<I>::value, "Bounds checked indexing requires an integer index");
+    return !index_is_negative(i)
+           && static_cast<std::size_t>(i) < static_cast<std::size_t>(container_size(c));
+}
+}
+
+// Policies for what strong::indexed does with the index before calling
+// operator[] of the underlying container. Each has a static function
+// check(container, index).
+namespace bounds
+{
+// Nothing, like operator[] of the standard containers.
+struct unchecked
+{
+    template <typename C, typename I>
+    static constexpr void check(const C&, const I&) noexcept {}
+};
+
+// Throw std::out_of_range, like at() of the standard containers.
+struct checked
+{
+    template <typename C, typename I>
+    static constexpr void check(const C& c, const I& i)
+    {
+        if (!impl::index_in_bounds(c, i))
+        {
+            throw std::out_of_range("strong::indexed: index out of range");
+        }
+    }
+};
+
+// Stop the program, without unwinding, which is cheaper than throwing in
+// the code around the access.
+struct hardened
+{
+    template <typename C, typename I>
+    static constexpr void check(const C& c, const I& i) noexcept
+    {
+        if (!impl::index_in_bounds(c, i))
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_trap();
+#else
+            std::abort();
+#endif
+        }
+    }
+};
+
+// Tell the optimizer that the index is in bounds, without checking. This
+// lets it remove checks made elsewhere, e.g. hoist the bounds check of a
+// hardened standard library out of a loop. An index out of bounds is
+// undefined behaviour.
+//
+// The assumption is a comparison of locals, since compilers drop assumptions
+// that call functions, which they can't prove free of side effects. A
+// negative index converts to a size_t that is not less than the size. Only
+// compilers with an assume, i.e. clang, gcc 13 and later, and MSVC, make use
+// of it.
+struct assume_in_bounds
+{
+    template <typename C, typename I>
+    static constexpr void check(const C& c, const I& i) noexcept
+    {
+        static_assert(std::is_integral<I>::value, "Bounds checked indexing requires an integer index");
+        const std::size_t size = static_cast<std::size_t>(impl::container_size(c));
+        const std::size_t index = static_cast<std::size_t>(i);
+        STRONG_ASSUME(index < size);
+    }
+};
+}
+
+template <typename I, typename Policy>
 struct indexed
 {
     template <typename T, typename = void>
@@ -29,8 +153,8 @@ struct indexed
     };
 };
 
-template <>
-struct indexed<void> {
+template <typename Policy>
+struct indexed<void, Policy> {
     template<typename>
     class modifier;
 
@@ -47,9 +171,11 @@ struct indexed<void> {
         operator[](
             const I &i)
         const &
-        noexcept(noexcept(std::declval<cref>()[impl::access(i)]))
+        noexcept(noexcept(Policy::check(std::declval<cref>(), impl::access(i)))
+                 && noexcept(std::declval<cref>()[impl::access(i)]))
         -> decltype(std::declval<cref>()[impl::access(i)]) {
             auto& self = static_cast<const type&>(*this);
+            Policy::check(value_of(static_cast<const type&>(*this)), impl::access(i));
             return value_of(self)[impl::access(i)];
         }
 
@@ -59,9 +185,11 @@ struct indexed<void> {
         operator[](
             const I &i)
         &
-        noexcept(noexcept(std::declval<ref>()[impl::access(i)]))
+        noexcept(noexcept(Policy::check(std::declval<cref>(), impl::access(i)))
+                 && noexcept(std::declval<ref>()[impl::access(i)]))
         -> decltype(std::declval<ref>()[impl::access(i)]) {
             auto& self = static_cast<type&>(*this);
+            Policy::check(value_of(static_cast<const type&>(*this)), impl::access(i));
             return value_of(self)[impl::access(i)];
         }
 
@@ -71,9 +199,11 @@ struct indexed<void> {
         operator[](
             const I &i)
         &&
-        noexcept(noexcept(std::declval<rref>()[impl::access(i)]))
+        noexcept(noexcept(Policy::check(std::declval<cref>(), impl::access(i)))
+                 && noexcept(std::declval<rref>()[impl::access(i)]))
         -> decltype(std::declval<rref>()[impl::access(i)]) {
             auto& self = static_cast<type&>(*this);
+            Policy::check(value_of(static_cast<const type&>(*this)), impl::access(i));
             return value_of(std::move(self))[impl::access(i)];
         }
 
@@ -112,9 +242,19 @@ struct indexed<void> {
     };
 };
 
-template <typename I>
+namespace impl
+{
+// The parameters of indexed<I, Policy> are not a list of modifiers, like the
+// types of ordered_with<Ts...>, so it is not split into indexed<I> and
+// indexed<Policy> when strong::type_is checks it.
+template <typename I, typename Policy, typename Type, typename HI, typename HPolicy>
+constexpr bool type_implements<indexed<I, Policy>, Type, indexed<HI, HPolicy>>
+    = std::is_same<indexed<I, Policy>, indexed<HI, HPolicy>>::value;
+}
+
+template <typename I, typename Policy>
 template <typename T, typename Tag, typename ... M>
-class indexed<I>::modifier<
+class indexed<I, Policy>::modifier<
     type<T, Tag, M...>,
     impl::void_t< decltype( std::declval<const T&>()[std::declval<underlying_type_t<I>>()] ) >
 >
@@ -126,10 +266,12 @@ public:
     operator[](
         const I& i)
     const &
-    noexcept(noexcept(std::declval<const T&>()[impl::access(i)]))
+    noexcept(noexcept(Policy::check(std::declval<const T&>(), impl::access(i)))
+             && noexcept(std::declval<const T&>()[impl::access(i)]))
     -> decltype(std::declval<const T&>()[impl::access(i)])
     {
         auto& self = static_cast<const type&>(*this);
+        Policy::check(value_of(static_cast<const type&>(*this)), impl::access(i));
         return value_of(self)[impl::access(i)];
     }
 
@@ -138,10 +280,12 @@ public:
     operator[](
         const I& i)
     &
-    noexcept(noexcept(std::declval<T&>()[impl::access(i)]))
+    noexcept(noexcept(Policy::check(std::declval<const T&>(), impl::access(i)))
+             && noexcept(std::declval<T&>()[impl::access(i)]))
     -> decltype(std::declval<T&>()[impl::access(i)])
     {
         auto& self = static_cast<type&>(*this);
+        Policy::check(value_of(static_cast<const type&>(*this)), impl::access(i));
         return value_of(self)[impl::access(i)];
     }
 
@@ -150,10 +294,12 @@ public:
     operator[](
         const I& i)
     &&
-    noexcept(noexcept(std::declval<T&&>()[impl::access(i)]))
+    noexcept(noexcept(Policy::check(std::declval<const T&>(), impl::access(i)))
+             && noexcept(std::declval<T&&>()[impl::access(i)]))
     -> decltype(std::declval<T&&>()[impl::access(i)])
     {
         auto& self = static_cast<type&>(*this);
+        Policy::check(value_of(static_cast<const type&>(*this)), impl::access(i));
         return value_of(std::move(self))[impl::access(i)];
     }
 
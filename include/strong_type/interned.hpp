@@ -0,0 +1,222 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_INTERNED_HPP
+#define STRONG_TYPE_INTERNED_HPP
+
+#include "type.hpp"
+#include "formattable.hpp"
+
+#if __cplusplus >= 201703L
+#define STRONG_TYPE_HAS_INTERNED 1
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#endif
+
+// Interned strings: each distinct string is stored once, in a pool per Tag,
+// and represented by a dense integer id. Comparing and hashing interned
+// strings is comparing and hashing the ids. The string is only looked up
+// when it is needed, e.g. for printing.
+
+namespace strong
+{
+// The strings are never released, so views of them are valid for the
+// lifetime of the program. Id 0 is the empty string.
+template <typename Tag>
+class intern_pool
+{
+public:
+    using id_type = std::uint32_t;
+
+    STRONG_NODISCARD
+    static intern_pool& instance()
+    {
+        static intern_pool pool;
+        return pool;
+    }
+
+    // The id of s, which is added to the pool if it is not already there.
+    STRONG_NODISCARD
+    id_type intern(std::string_view s)
+    {
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            auto i = index_.find(s);
+            if (i != index_.end()) return i->second;
+        }
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        auto i = index_.find(s);
+        if (i != index_.end()) return i->second;
+        if (strings_.size() > std::numeric_limits<id_type>::max())
+        {
+            throw std::length_error("strong::intern_pool is full");
+        }
+        const auto id = static_cast<id_type>(strings_.size());
+        const std::string& stored = strings_.emplace_back(s);
+        index_.emplace(std::string_view(stored), id);
+        return id;
+    }
+
+    STRONG_NODISCARD
+    std::string_view lookup(id_type id) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return strings_[id];
+    }
+
+    STRONG_NODISCARD
+    std::size_t size() const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return strings_.size();
+    }
+private:
+    intern_pool()
+    {
+        strings_.emplace_back();
+        index_.emplace(std::string_view(strings_.front()), id_type{0});
+    }
+
+    mutable std::shared_mutex mutex_;
+    // A deque never moves its elements, so the views in index_ stay valid.
+    std::deque<std::string> strings_;
+    std::unordered_map<std::string_view, id_type> index_;
+};
+
+// The id of a string in intern_pool<Tag>. Comparisons are of the ids, so <
+// is the order in which the strings were first interned. Use
+// strong::lexical_less for alphabetical order.
+template <typename Tag>
+class interned_string
+{
+public:
+    using id_type = typename intern_pool<Tag>::id_type;
+
+    constexpr interned_string() noexcept = default;
+
+    explicit interned_string(std::string_view s)
+        : id_(intern_pool<Tag>::instance().intern(s))
+    {
+    }
+
+    STRONG_NODISCARD
+    constexpr id_type id() const noexcept { return id_; }
+
+    STRONG_NODISCARD
+    std::string_view view() const
+    {
+        return intern_pool<Tag>::instance().lookup(id_);
+    }
+
+    STRONG_NODISCARD
+    friend constexpr bool operator==(interned_string lh, interned_string rh) noexcept { return lh.id_ == rh.id_; }
+    STRONG_NODISCARD
+    friend constexpr bool operator!=(interned_string lh, interned_string rh) noexcept { return lh.id_ != rh.id_; }
+    STRONG_NODISCARD
+    friend constexpr bool operator<(interned_string lh, interned_string rh) noexcept { return lh.id_ < rh.id_; }
+    STRONG_NODISCARD
+    friend constexpr bool operator<=(interned_string lh, interned_string rh) noexcept { return lh.id_ <= rh.id_; }
+    STRONG_NODISCARD
+    friend constexpr bool operator>(interned_string lh, interned_string rh) noexcept { return lh.id_ > rh.id_; }
+    STRONG_NODISCARD
+    friend constexpr bool operator>=(interned_string lh, interned_string rh) noexcept { return lh.id_ >= rh.id_; }
+
+    // A template, so that <ostream> is only needed by those who print.
+    template <typename OS, typename = decltype(std::declval<OS&>() << std::declval<std::string_view>())>
+    friend OS& operator<<(OS& os, interned_string s)
+    {
+        os << s.view();
+        return os;
+    }
+private:
+    id_type id_ = 0;
+};
+
+// A strong type for interned strings, e.g.
+// using metric_name = strong::interned<struct metric_name_, strong::regular, strong::hashable>;
+template <typename Tag, typename ... M>
+using interned = type<interned_string<Tag>, Tag, M...>;
+
+// Alphabetical order of interned strings, or strong types of them.
+struct lexical_less
+{
+    template <typename Tag>
+    STRONG_NODISCARD
+    bool operator()(const interned_string<Tag>& lh, const interned_string<Tag>& rh) const
+    {
+        return lh == rh ? false : lh.view() < rh.view();
+    }
+
+    template <typename Tag, typename ... M>
+    STRONG_NODISCARD
+    bool operator()(const type<interned_string<Tag>, Tag, M...>& lh, const type<interned_string<Tag>, Tag, M...>& rh) const
+    {
+        return (*this)(value_of(lh), value_of(rh));
+    }
+};
+}
+
+namespace std
+{
+template <typename Tag>
+struct hash<::strong::interned_string<Tag>>
+{
+    STRONG_NODISCARD
+    std::size_t operator()(::strong::interned_string<Tag> s) const noexcept
+    {
+        return std::hash<typename ::strong::interned_string<Tag>::id_type>{}(s.id());
+    }
+};
+
+#if STRONG_HAS_STD_FORMAT
+template <typename Tag>
+struct formatter<::strong::interned_string<Tag>, char> : formatter<std::string_view, char>
+{
+    template <typename FormatContext>
+    decltype(auto) format(::strong::interned_string<Tag> s, FormatContext& fc) const
+    {
+        return formatter<std::string_view, char>::format(s.view(), fc);
+    }
+};
+#endif
+}
+
+#if STRONG_HAS_FMT_FORMAT
+namespace fmt
+{
+template <typename Tag>
+struct formatter<::strong::interned_string<Tag>, char> : formatter<string_view, char>
+{
+    template <typename FormatContext>
+    decltype(auto) format(::strong::interned_string<Tag> s, FormatContext& fc) const
+    {
+        const auto v = s.view();
+        return formatter<string_view, char>::format(string_view(v.data(), v.size()), fc);
+    }
+};
+}
+#endif
+
+#endif
+
+#endif //STRONG_TYPE_INTERNED_HPP
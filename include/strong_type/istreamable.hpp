@@ -17,21 +17,35 @@
 #include "type.hpp"
 
 #if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
-#include <istream>
+#include <iosfwd>
 #endif
 
 namespace strong
 {
+namespace impl
+{
+template <typename IS, typename U, typename = void>
+struct can_stream_in : std::false_type {};
+
+template <typename IS, typename U>
+struct can_stream_in<IS, U, void_t<decltype(std::declval<IS&>() >> std::declval<U&>())>>
+    : std::true_type {};
+
+// Only <iosfwd> is needed to declare the operator. The stream type is
+// complete where it is used, which is when this is instantiated.
+template <typename IS, typename U>
+IS& stream_in(IS& is, U& u)
+{
+    static_assert(can_stream_in<IS, U>::value,
+                  "Underlying type must support stream input via operator>>");
+    return is >> u;
+}
+}
+
 struct istreamable
 {
-    template <typename T, typename = void>
-    class  modifier
-    {
-        static_assert(impl::always_false<T>,
-            "Underlying type must support stream input via operator>>");
-    };
     template <typename T>
-    class modifier<T, impl::void_t<decltype(std::declval<std::istream&>() >> std::declval<underlying_type_t<T>&>())>>
+    class modifier
     {
     public:
         friend
@@ -40,7 +54,7 @@ struct istreamable
             std::istream &is,
             T &t)
         {
-            return is >> value_of(t);
+            return impl::stream_in(is, value_of(t));
         }
     };
 };
@@ -17,21 +17,35 @@
 #include "type.hpp"
 
 #if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
-#include <ostream>
+#include <iosfwd>
 #endif
 
 namespace strong
 {
+namespace impl
+{
+template <typename OS, typename U, typename = void>
+struct can_stream_out : std::false_type {};
+
+template <typename OS, typename U>
+struct can_stream_out<OS, U, void_t<decltype(std::declval<OS&>() << std::declval<const U&>())>>
+    : std::true_type {};
+
+// Only <iosfwd> is needed to declare the operator. The stream type is
+// complete where it is used, which is when this is instantiated.
+template <typename OS, typename U>
+OS& stream_out(OS& os, const U& u)
+{
+    static_assert(can_stream_out<OS, U>::value,
+                  "Underlying type must support stream output via operator<<");
+    return os << u;
+}
+}
+
 struct ostreamable
 {
-    template <typename T, typename = void>
-    class modifier
-    {
-        static_assert(impl::always_false<T>,
-            "Underlying type support stream output via operator<<");
-    };
     template <typename T>
-    class modifier<T, impl::void_t<decltype(std::declval<std::ostream&>() << std::declval<const underlying_type_t<T>&>())>>
+    class modifier
     {
     public:
         friend
@@ -40,7 +54,7 @@ struct ostreamable
             std::ostream &os,
             const T &t)
         {
-            return os << value_of(t);
+            return impl::stream_out(os, value_of(t));
         }
     };
 };
@@ -0,0 +1,276 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_RADIX_SORT_HPP
+#define STRONG_TYPE_RADIX_SORT_HPP
+
+#include "type.hpp"
+#include "ordered.hpp"
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+#endif
+
+// Least significant digit radix sort of strong types whose underlying type
+// is an integer or an IEEE floating point type, and whose ordering is that of
+// the underlying type, i.e. that have strong::ordered, or in C++20
+// strong::strongly_ordered, strong::weakly_ordered or
+// strong::partially_ordered. The sort is stable, and takes a fixed number of
+// passes over the data, one per byte of the underlying type, instead of the
+// n log n comparisons of std::sort.
+//
+// Floating point values are sorted as by <, except that -0.0 comes before
+// +0.0, and NaNs with the sign bit set come first and other NaNs last.
+
+namespace strong
+{
+namespace impl
+{
+// An unsigned integer whose order as an unsigned integer is the order of
+// the value.
+template <typename T, typename = void>
+struct radix_key
+{
+    static constexpr bool valid = false;
+};
+
+template <typename T>
+struct radix_key<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>>
+{
+    static constexpr bool valid = true;
+    using type = std::make_unsigned_t<T>;
+
+    static type get(T t) noexcept
+    {
+        constexpr type sign = std::is_signed<T>::value
+                              ? static_cast<type>(type{1} << (std::numeric_limits<type>::digits - 1))
+                              : type{0};
+        return static_cast<type>(static_cast<type>(t) ^ sign);
+    }
+};
+
+template <typename T>
+struct radix_float_bits;
+template <>
+struct radix_float_bits<float> { using type = std::uint32_t; };
+template <>
+struct radix_float_bits<double> { using type = std::uint64_t; };
+
+template <typename T>
+struct radix_key<T, std::enable_if_t<std::numeric_limits<T>::is_iec559
+                                     && (sizeof(T) == sizeof(typename radix_float_bits<T>::type))>>
+{
+    static constexpr bool valid = true;
+    using type = typename radix_float_bits<T>::type;
+
+    // Negative values have all bits flipped, so that larger magnitudes come
+    // first, and positive values have the sign bit set, to come after them.
+    static type get(T t) noexcept
+    {
+        type bits;
+        std::memcpy(&bits, &t, sizeof(bits));
+        constexpr unsigned top = std::numeric_limits<type>::digits - 1;
+        const type negative = static_cast<type>(bits >> top);
+        const type mask = static_cast<type>(static_cast<type>(type{0} - negative) | static_cast<type>(type{1} << top));
+        return static_cast<type>(bits ^ mask);
+    }
+};
+
+template <typename S, typename = void>
+struct radix_sortable : std::false_type {};
+
+template <typename S>
+struct radix_sortable<S, std::enable_if_t<is_strong_type<S>::value>>
+    : std::integral_constant<bool,
+                             radix_key<underlying_type_t<S>>::valid
+                             && (type_is_v<S, ordered>
+#if __cpp_impl_three_way_comparison && __has_include(<compare>)
+                                 || type_is_v<S, strongly_ordered>
+                                 || type_is_v<S, weakly_ordered>
+                                 || type_is_v<S, partially_ordered>
+#endif
+                             )>
+{
+};
+
+template <typename S>
+typename radix_key<underlying_type_t<S>>::type radix_key_of(const S& s) noexcept
+{
+    return radix_key<underlying_type_t<S>>::get(value_of(s));
+}
+
+// Sorts [data, data + n) by key(element), using buffer, which has room for
+// n elements, as scratch space.
+template <typename T, typename Key>
+void lsd_radix_sort(T* data, T* buffer, std::size_t n, Key key)
+{
+    using K = decltype(key(*data));
+    constexpr std::size_t passes = sizeof(K);
+    std::vector<std::array<std::size_t, 256>> counts(passes);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        const K k = key(data[i]);
+        for (std::size_t p = 0; p != passes; ++p)
+        {
+            ++counts[p][static_cast<unsigned char>(k >> (8 * p))];
+        }
+    }
+    T* src = data;
+    T* dst = buffer;
+    for (std::size_t p = 0; p != passes; ++p)
+    {
+        auto& offsets = counts[p];
+        // A byte that is the same in all keys does not change the order.
+        if (offsets[static_cast<unsigned char>(key(src[0]) >> (8 * p))] == n) continue;
+        std::size_t sum = 0;
+        for (auto& o : offsets)
+        {
+            const auto c = o;
+            o = sum;
+            sum += c;
+        }
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            dst[offsets[static_cast<unsigned char>(key(src[i]) >> (8 * p))]++] = std::move(src[i]);
+        }
+        std::swap(src, dst);
+    }
+    if (src != data)
+    {
+        std::move(src, src + n, data);
+    }
+}
+
+// Below this many elements, a comparison sort is faster than counting.
+constexpr std::size_t radix_sort_threshold = 64;
+
+template <typename Index, typename It, typename KeyFn>
+void radix_sort_by_key(It first, std::size_t n, KeyFn& key)
+{
+    using V = typename std::iterator_traits<It>::value_type;
+    using K = decltype(radix_key_of(key(*first)));
+    std::vector<std::pair<K, Index>> entries;
+    entries.reserve(n);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        entries.emplace_back(radix_key_of(key(first[static_cast<std::ptrdiff_t>(i)])), static_cast<Index>(i));
+    }
+    std::vector<std::pair<K, Index>> buffer(n);
+    lsd_radix_sort(entries.data(), buffer.data(), n,
+                   [](const std::pair<K, Index>& e) { return e.first; });
+    std::vector<V> sorted;
+    sorted.reserve(n);
+    for (const auto& e : entries)
+    {
+        sorted.push_back(std::move(first[static_cast<std::ptrdiff_t>(e.second)]));
+    }
+    std::move(sorted.begin(), sorted.end(), first);
+}
+
+template <typename R, typename = void>
+struct has_data : std::false_type {};
+template <typename R>
+struct has_data<R, void_t<decltype(std::declval<R&>().data() + std::declval<R&>().size())>> : std::true_type {};
+}
+
+// Sort the strong types in [first, last), which must be random access
+// iterators. With pointers, the sort is in place, with other iterators
+// through a copy.
+template <typename It>
+std::enable_if_t<impl::radix_sortable<typename std::iterator_traits<It>::value_type>::value>
+radix_sort(It first, It last)
+{
+    using T = typename std::iterator_traits<It>::value_type;
+    const auto n = static_cast<std::size_t>(std::distance(first, last));
+    if (n < impl::radix_sort_threshold)
+    {
+        std::stable_sort(first, last, [](const T& lh, const T& rh) { return impl::radix_key_of(lh) < impl::radix_key_of(rh); });
+        return;
+    }
+    auto key = [](const T& t) { return impl::radix_key_of(t); };
+    std::vector<T> buffer(first, last);
+    if (std::is_pointer<It>::value)
+    {
+        impl::lsd_radix_sort(&*first, buffer.data(), n, key);
+    }
+    else
+    {
+        std::vector<T> data(buffer);
+        impl::lsd_radix_sort(data.data(), buffer.data(), n, key);
+        std::move(data.begin(), data.end(), first);
+    }
+}
+
+// Sort a range of strong types, in place if it is contiguous, e.g. a
+// std::vector or a std::array.
+template <typename R>
+std::enable_if_t<impl::radix_sortable<std::decay_t<decltype(*std::begin(std::declval<R&>()))>>::value>
+radix_sort(R&& r)
+{
+    using std::begin;
+    using std::end;
+    if (impl::has_data<R>::value && begin(r) != end(r))
+    {
+        radix_sort(&*begin(r), &*begin(r) + std::distance(begin(r), end(r)));
+    }
+    else
+    {
+        radix_sort(begin(r), end(r));
+    }
+}
+
+// Stable sort of the elements in [first, last), which must be random access
+// iterators, by key(element), which is a strong type that radix_sort()
+// accepts, e.g. a timestamp member.
+template <typename It, typename KeyFn>
+std::enable_if_t<impl::radix_sortable<std::decay_t<decltype(std::declval<KeyFn&>()(*std::declval<It&>()))>>::value>
+radix_sort_by_key(It first, It last, KeyFn key)
+{
+    using V = typename std::iterator_traits<It>::value_type;
+    const auto n = static_cast<std::size_t>(std::distance(first, last));
+    if (n < impl::radix_sort_threshold)
+    {
+        std::stable_sort(first, last, [&key](const V& lh, const V& rh) {
+            return impl::radix_key_of(key(lh)) < impl::radix_key_of(key(rh));
+        });
+        return;
+    }
+    if (n <= std::numeric_limits<std::uint32_t>::max())
+    {
+        impl::radix_sort_by_key<std::uint32_t>(first, n, key);
+    }
+    else
+    {
+        impl::radix_sort_by_key<std::size_t>(first, n, key);
+    }
+}
+
+template <typename R, typename KeyFn>
+auto radix_sort_by_key(R&& r, KeyFn key)
+-> decltype(radix_sort_by_key(std::begin(r), std::end(r), std::move(key)))
+{
+    using std::begin;
+    using std::end;
+    radix_sort_by_key(begin(r), end(r), std::move(key));
+}
+}
+
+#endif //STRONG_TYPE_RADIX_SORT_HPP
@@ -16,53 +16,322 @@
 
 #include "type.hpp"
 
+#include "span.hpp"
+
 #if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <numeric>
 #endif
 
-#if __cpp_lib_saturation_arithmetic
+#if defined(STRONG_TYPE_HAS_SPAN) && defined(__SSE2__) && !defined(STRONG_TYPE_NO_INTRINSICS)
+#include <emmintrin.h>
+#define STRONG_TYPE_SATURATING_SSE2 1
+#endif
+
+namespace strong
+{
+namespace impl
+{
+// Saturating addition and subtraction without branches, written so that
+// compilers turn loops of them into packed saturating instructions, e.g.
+// paddusb and paddsw on x86.
+template <typename T>
+using WhenSaturatingUnsigned = std::enable_if_t<std::is_unsigned<T>::value && !std::is_same<T, bool>::value, T>;
+template <typename T>
+using WhenSaturatingNarrowSigned = std::enable_if_t<std::is_signed<T>::value && std::is_integral<T>::value && (sizeof(T) < sizeof(long long)), T>;
+template <typename T>
+using WhenSaturatingWideSigned = std::enable_if_t<std::is_signed<T>::value && std::is_integral<T>::value && (sizeof(T) == sizeof(long long)), T>;
+
+template <typename T>
+using wider_signed_t = std::conditional_t<(sizeof(T) < sizeof(int)), int, long long>;
+
+template <typename T>
+constexpr WhenSaturatingUnsigned<T> branchless_add_sat(T a, T b) noexcept
+{
+    const T r = static_cast<T>(a + b);
+    return static_cast<T>(r | static_cast<T>(-static_cast<T>(r < a)));
+}
+
+template <typename T>
+constexpr WhenSaturatingUnsigned<T> branchless_sub_sat(T a, T b) noexcept
+{
+    const T r = static_cast<T>(a - b);
+    return static_cast<T>(r & static_cast<T>(-static_cast<T>(r <= a)));
+}
+
+template <typename T>
+constexpr wider_signed_t<T> clamp_to(wider_signed_t<T> r) noexcept
+{
+    using W = wider_signed_t<T>;
+    constexpr W min = std::numeric_limits<T>::min();
+    constexpr W max = std::numeric_limits<T>::max();
+    r = r < min ? min : r;
+    return r > max ? max : r;
+}
+
+template <typename T>
+constexpr WhenSaturatingNarrowSigned<T> branchless_add_sat(T a, T b) noexcept
+{
+    using W = wider_signed_t<T>;
+    return static_cast<T>(clamp_to<T>(static_cast<W>(static_cast<W>(a) + static_cast<W>(b))));
+}
+
+template <typename T>
+constexpr WhenSaturatingNarrowSigned<T> branchless_sub_sat(T a, T b) noexcept
+{
+    using W = wider_signed_t<T>;
+    return static_cast<T>(clamp_to<T>(static_cast<W>(static_cast<W>(a) - static_cast<W>(b))));
+}
+
+// There is no wider type, so detect overflow from the sign bits of the
+// wrapped result. On overflow, the result is min if a is negative, and max
+// otherwise.
+template <typename T>
+constexpr WhenSaturatingWideSigned<T> branchless_add_sat(T a, T b) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+    const U ua = static_cast<U>(a);
+    const U ub = static_cast<U>(b);
+    const U ur = ua + ub;
+    const U sat = (ua >> (sizeof(T) * 8 - 1)) + static_cast<U>(std::numeric_limits<T>::max());
+    return static_cast<T>((ua ^ ur) & (ub ^ ur)) < 0 ? static_cast<T>(sat) : static_cast<T>(ur);
+}
+
+template <typename T>
+constexpr WhenSaturatingWideSigned<T> branchless_sub_sat(T a, T b) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+    const U ua = static_cast<U>(a);
+    const U ub = static_cast<U>(b);
+    const U ur = ua - ub;
+    const U sat = (ua >> (sizeof(T) * 8 - 1)) + static_cast<U>(std::numeric_limits<T>::max());
+    return static_cast<T>((ua ^ ub) & (ua ^ ur)) < 0 ? static_cast<T>(sat) : static_cast<T>(ur);
+}
+
+template <typename T>
+using WhenSaturatingInteger = std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>;
+
+template <typename T>
+constexpr std::enable_if_t<std::is_signed<T>::value, bool> is_negative(T t) noexcept { return t < 0; }
+template <typename T>
+constexpr std::enable_if_t<!std::is_signed<T>::value, bool> is_negative(T) noexcept { return false; }
+
+template <typename A, typename B>
+constexpr std::enable_if_t<std::is_signed<A>::value == std::is_signed<B>::value, bool>
+cmp_less(A a, B b) noexcept
+{
+    return a < b;
+}
+
+template <typename A, typename B>
+constexpr std::enable_if_t<std::is_signed<A>::value && !std::is_signed<B>::value, bool>
+cmp_less(A a, B b) noexcept
+{
+    return a < 0 || static_cast<std::make_unsigned_t<A>>(a) < b;
+}
 
-#if __cpp_lib_saturation_arithmetic == 202311L
-#define STRONG_SATURATION(op) std::op ## _sat
+template <typename A, typename B>
+constexpr std::enable_if_t<!std::is_signed<A>::value && std::is_signed<B>::value, bool>
+cmp_less(A a, B b) noexcept
+{
+    return b >= 0 && a < static_cast<std::make_unsigned_t<B>>(b);
+}
+
+template <typename R, typename T>
+constexpr R saturate_cast(T t) noexcept
+{
+    return cmp_less(t, std::numeric_limits<R>::min()) ? std::numeric_limits<R>::min()
+         : cmp_less(std::numeric_limits<R>::max(), t) ? std::numeric_limits<R>::max()
+         : static_cast<R>(t);
+}
+
+// The scalar saturating operations. The compiler builtins check the
+// overflow flag, so a result is a flag test and a conditional move, with no
+// branch to mispredict. Without them, add and sub use the branchless
+// versions above, and mul checks the operands before multiplying.
+#if !defined(STRONG_TYPE_HAS_OVERFLOW_BUILTINS)
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_add_overflow) && __has_builtin(__builtin_sub_overflow) && __has_builtin(__builtin_mul_overflow)
+#define STRONG_TYPE_HAS_OVERFLOW_BUILTINS 1
+#endif
+#endif
+#endif
+#if !defined(STRONG_TYPE_HAS_OVERFLOW_BUILTINS)
+#define STRONG_TYPE_HAS_OVERFLOW_BUILTINS 0
+#endif
+
+template <typename T>
+constexpr T add_sat(T a, T b) noexcept
+{
+#if STRONG_TYPE_HAS_OVERFLOW_BUILTINS
+    T r{};
+    const bool overflow = __builtin_add_overflow(a, b, &r);
+    return overflow
+           ? (is_negative(b) ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max())
+           : r;
 #else
-#define STRONG_SATURATION(op) std::saturating_ ## op
+    return branchless_add_sat(a, b);
 #endif
+}
 
-namespace strong
+template <typename T>
+constexpr T sub_sat(T a, T b) noexcept
 {
-    namespace impl
+#if STRONG_TYPE_HAS_OVERFLOW_BUILTINS
+    T r{};
+    const bool overflow = __builtin_sub_overflow(a, b, &r);
+    return overflow
+           ? (is_negative(b) ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min())
+           : r;
+#else
+    return branchless_sub_sat(a, b);
+#endif
+}
+
+template <typename T>
+constexpr T mul_sat(T a, T b) noexcept
+{
+    constexpr T min = std::numeric_limits<T>::min();
+    constexpr T max = std::numeric_limits<T>::max();
+#if STRONG_TYPE_HAS_OVERFLOW_BUILTINS
+    T r{};
+    const bool overflow = __builtin_mul_overflow(a, b, &r);
+    return overflow
+           ? (is_negative(a) != is_negative(b) ? min : max)
+           : r;
+#else
+    if (a == 0 || b == 0) return 0;
+    if (is_negative(a) == is_negative(b))
     {
-        template <typename T>
-        concept saturating_type = requires (underlying_type_t<T> t){STRONG_SATURATION(add)(t,t);};
+        // positive result, too large if |a| > max / |b|
+        return (is_negative(a) ? a < max / b : a > max / b) ? max : static_cast<T>(a * b);
     }
-struct saturating_arithmetic
+    // negative result, too small if |a| > |min / b|
+    return (is_negative(a) ? a < min / b : b < min / a) ? min : static_cast<T>(a * b);
+#endif
+}
+
+template <typename T>
+constexpr T div_sat(T a, T b) noexcept
+{
+    // min / -1 is the only division that overflows
+    return std::is_signed<T>::value && a == std::numeric_limits<T>::min() && b == static_cast<T>(-1)
+           ? std::numeric_limits<T>::max()
+           : static_cast<T>(a / b);
+}
+}
+
+#if defined(STRONG_TYPE_HAS_SPAN)
+namespace impl
+{
+struct add_sat_op
 {
-    template <impl::saturating_type>
-    class modifier;
+    template <typename T>
+    static constexpr T apply(T a, T b) noexcept { return branchless_add_sat(a, b); }
+#if defined(STRONG_TYPE_SATURATING_SSE2)
+    static __m128i apply(__m128i a, __m128i b, std::int8_t) noexcept { return _mm_adds_epi8(a, b); }
+    static __m128i apply(__m128i a, __m128i b, std::uint8_t) noexcept { return _mm_adds_epu8(a, b); }
+    static __m128i apply(__m128i a, __m128i b, std::int16_t) noexcept { return _mm_adds_epi16(a, b); }
+    static __m128i apply(__m128i a, __m128i b, std::uint16_t) noexcept { return _mm_adds_epu16(a, b); }
+#endif
 };
 
+struct sub_sat_op
+{
+    template <typename T>
+    static constexpr T apply(T a, T b) noexcept { return branchless_sub_sat(a, b); }
+#if defined(STRONG_TYPE_SATURATING_SSE2)
+    static __m128i apply(__m128i a, __m128i b, std::int8_t) noexcept { return _mm_subs_epi8(a, b); }
+    static __m128i apply(__m128i a, __m128i b, std::uint8_t) noexcept { return _mm_subs_epu8(a, b); }
+    static __m128i apply(__m128i a, __m128i b, std::int16_t) noexcept { return _mm_subs_epi16(a, b); }
+    static __m128i apply(__m128i a, __m128i b, std::uint16_t) noexcept { return _mm_subs_epu16(a, b); }
+#endif
+};
+
+template <typename Op, typename U>
+void saturate_n(U* dst, const U* src, std::size_t size) noexcept
+{
+    std::size_t i = 0;
+#if defined(STRONG_TYPE_SATURATING_SSE2)
+    // The compilers do not reliably find the packed saturating instructions
+    // for 8 and 16 bit lanes, so use them explicitly.
+    constexpr bool packed = std::is_same<U, std::int8_t>::value
+                            || std::is_same<U, std::uint8_t>::value
+                            || std::is_same<U, std::int16_t>::value
+                            || std::is_same<U, std::uint16_t>::value;
+    if constexpr (packed)
+    {
+        constexpr std::size_t lanes = sizeof(__m128i) / sizeof(U);
+        for (; i + lanes <= size; i += lanes)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), Op::apply(a, b, U{}));
+        }
+    }
+#endif
+    for (; i != size; ++i)
+    {
+        dst[i] = Op::apply(dst[i], src[i]);
+    }
+}
+}
+
+// dst[i] = saturated dst[i] + src[i], for i in [0, min(dst.size(), src.size())).
+// Works on any strong type with an integral underlying type, regardless of
+// its modifiers, like strong::as_underlying() does.
+template <typename S, std::size_t N>
+void saturating_add(std::span<S, N> dst, std::type_identity_t<std::span<const S>> src) noexcept
+{
+    using U = underlying_type_t<S>;
+    static_assert(std::is_integral<U>::value, "Underlying type must be integral");
+    const auto d = as_underlying(dst);
+    const auto s = as_underlying(src);
+    impl::saturate_n<impl::add_sat_op>(d.data(), s.data(), std::min(d.size(), s.size()));
+}
 
-template <std::integral T, typename Tag, typename ... M>
-    requires requires {STRONG_SATURATION(add)(std::declval<T>(), std::declval<T>()); }
-class saturating_arithmetic::modifier<::strong::type<T, Tag, M...>>
+// dst[i] = saturated dst[i] - src[i], for i in [0, min(dst.size(), src.size())).
+template <typename S, std::size_t N>
+void saturating_sub(std::span<S, N> dst, std::type_identity_t<std::span<const S>> src) noexcept
+{
+    using U = underlying_type_t<S>;
+    static_assert(std::is_integral<U>::value, "Underlying type must be integral");
+    const auto d = as_underlying(dst);
+    const auto s = as_underlying(src);
+    impl::saturate_n<impl::sub_sat_op>(d.data(), s.data(), std::min(d.size(), s.size()));
+}
+#endif
+}
+
+namespace strong
+{
+struct saturating_arithmetic
+{
+    template <typename T, typename = void>
+    class modifier
+    {
+        static_assert(impl::always_false<T>,
+                      "Underlying type must be an integer type");
+    };
+};
+
+template <typename T, typename Tag, typename ... M>
+class saturating_arithmetic::modifier<::strong::type<T, Tag, M...>, impl::WhenSaturatingInteger<T>>
 {
     using type = strong::type<T, Tag, M...>;
 public:
     template <typename U>
     static constexpr void limit(U& u)
     {
-#if __cpp_lib_saturation_arithmetic == 202311L
-        u = static_cast<U>(std::saturate_cast<T>(u));
-#else
-        u = static_cast<U>(std::saturating_cast<T>(u));
-#endif
-
+        u = static_cast<U>(impl::saturate_cast<T>(u));
     }
     friend
     STRONG_CONSTEXPR
     type& operator+=(type& lh, type rh)
     {
-        value_of(lh) = STRONG_SATURATION(add)(value_of(lh), value_of(rh));
+        value_of(lh) = impl::add_sat(value_of(lh), value_of(rh));
         return lh;
     }
 
@@ -78,7 +347,7 @@ public:
     STRONG_CONSTEXPR
     type& operator-=(type& lh, type rh)
     {
-        value_of(lh) = STRONG_SATURATION(sub)(value_of(lh), value_of(rh));
+        value_of(lh) = impl::sub_sat(value_of(lh), value_of(rh));
         return lh;
     }
 
@@ -94,7 +363,7 @@ public:
     STRONG_CONSTEXPR
     type& operator*=(type& lh, type rh)
     {
-        value_of(lh) = STRONG_SATURATION(mul)(value_of(lh), value_of(rh));
+        value_of(lh) = impl::mul_sat(value_of(lh), value_of(rh));
         return lh;
     }
 
@@ -110,7 +379,7 @@ public:
     STRONG_CONSTEXPR
     type& operator/=(type& lh, type rh)
     {
-        value_of(lh) = STRONG_SATURATION(div)(value_of(lh), value_of(rh));
+        value_of(lh) = impl::div_sat(value_of(lh), value_of(rh));
         return lh;
     }
 
@@ -121,26 +390,17 @@ public:
     {
         return lh/= rh;
     }
-
-
 };
 
-template <typename T1, typename T2>
-    requires strong::type_is_v<T1, saturating_arithmetic>
-    && impl::saturating_type<underlying_type_t<T2>>
+template <typename T1, typename T2,
+          typename = std::enable_if_t<strong::type_is_v<T1, saturating_arithmetic>>,
+          typename = impl::WhenSaturatingInteger<underlying_type_t<T2>>>
 STRONG_NODISCARD
 STRONG_CONSTEXPR
 T1 saturating_cast(T2 t2)
-    {
-#if __cpp_lib_saturation_arithmetic == 202311L
-        return T1{std::saturate_cast<underlying_type_t<T1>>(impl::access(t2))};
-#else
-        return T1{std::saturating_cast<underlying_type_t<T1>>(impl::access(t2))};
-#endif
-    }
-
-
+{
+    return T1{impl::saturate_cast<underlying_type_t<T1>>(impl::access(t2))};
+}
 }
 
-#endif
 #endif //STRONG_TYPE_SATURATING_HPP
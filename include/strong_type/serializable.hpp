@@ -0,0 +1,295 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_SERIALIZABLE_HPP
+#define STRONG_TYPE_SERIALIZABLE_HPP
+
+#include "type.hpp"
+#include "span.hpp"
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#endif
+
+// Byte order of the serialized value. native is the byte order of the
+// machine, and is the same type as one of little or big.
+namespace strong
+{
+namespace endian
+{
+struct little {};
+struct big {};
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+using native = big;
+#else
+using native = little;
+#endif
+}
+
+namespace impl
+{
+// The types of byte buffers that values are written to and read from.
+template <typename B>
+struct is_byte : std::false_type {};
+template <>
+struct is_byte<char> : std::true_type {};
+template <>
+struct is_byte<unsigned char> : std::true_type {};
+#if __cplusplus >= 201703L
+template <>
+struct is_byte<std::byte> : std::true_type {};
+#endif
+
+template <typename B>
+using if_byte = std::enable_if_t<is_byte<B>::value>;
+
+template <std::size_t N>
+struct unsigned_of_size;
+template <>
+struct unsigned_of_size<1> { using type = std::uint8_t; };
+template <>
+struct unsigned_of_size<2> { using type = std::uint16_t; };
+template <>
+struct unsigned_of_size<4> { using type = std::uint32_t; };
+template <>
+struct unsigned_of_size<8> { using type = std::uint64_t; };
+
+inline std::uint8_t byteswap(std::uint8_t u) noexcept { return u; }
+inline std::uint16_t byteswap(std::uint16_t u) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(u);
+#else
+    return static_cast<std::uint16_t>((u << 8) | (u >> 8));
+#endif
+}
+inline std::uint32_t byteswap(std::uint32_t u) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(u);
+#else
+    return (u << 24) | ((u << 8) & 0x00ff0000U) | ((u >> 8) & 0x0000ff00U) | (u >> 24);
+#endif
+}
+inline std::uint64_t byteswap(std::uint64_t u) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(u);
+#else
+    return (std::uint64_t{byteswap(static_cast<std::uint32_t>(u))} << 32)
+           | byteswap(static_cast<std::uint32_t>(u >> 32));
+#endif
+}
+
+// Writes and reads the bytes of a T, in the byte order of Endian. The
+// compiler turns the std::memcpy() into a plain load or store, and the
+// byteswap, when there is one, into a single instruction.
+template <typename Endian, typename T>
+struct wire_codec
+{
+    static_assert(std::is_same<Endian, endian::little>::value || std::is_same<Endian, endian::big>::value,
+                  "Endian must be strong::endian::little, strong::endian::big or strong::endian::native");
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "The underlying type must be trivially copyable");
+
+    static constexpr bool swap = !std::is_same<Endian, endian::native>::value;
+
+    // The byte order is only meaningful for scalars. Any trivially copyable
+    // type can be written in native byte order.
+    static_assert(!swap || ((std::is_arithmetic<T>::value || std::is_enum<T>::value)
+                            && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)),
+                  "Only integer, floating point and enum types of 1, 2, 4 or 8 bytes can be written in non-native byte order");
+
+    template <typename B>
+    static void write(B* p, const T& t) noexcept
+    {
+        write(p, t, std::integral_constant<bool, swap>{});
+    }
+
+    template <typename B>
+    static void read(const B* p, T& t) noexcept
+    {
+        read(p, t, std::integral_constant<bool, swap>{});
+    }
+
+    // Values whose object representation is only that of T are copied all
+    // at once, when the byte order is native.
+    template <typename S, typename B>
+    static void write_n(B* p, const S* values, std::size_t n) noexcept
+    {
+        if (!swap && sizeof(S) == sizeof(T) && std::is_trivially_copyable<S>::value)
+        {
+            if (n != 0) std::memcpy(p, values, n * sizeof(T));
+            return;
+        }
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            write(p + i * sizeof(T), value_of(values[i]));
+        }
+    }
+
+    template <typename S, typename B>
+    static void read_n(const B* p, S* values, std::size_t n) noexcept
+    {
+        if (!swap && sizeof(S) == sizeof(T) && std::is_trivially_copyable<S>::value)
+        {
+            if (n != 0) std::memcpy(static_cast<void*>(values), p, n * sizeof(T));
+            return;
+        }
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            read(p + i * sizeof(T), value_of(values[i]));
+        }
+    }
+private:
+    template <typename B>
+    static void write(B* p, const T& t, std::false_type) noexcept
+    {
+        std::memcpy(p, &t, sizeof(T));
+    }
+
+    template <typename B>
+    static void write(B* p, const T& t, std::true_type) noexcept
+    {
+        typename unsigned_of_size<sizeof(T)>::type u;
+        std::memcpy(&u, &t, sizeof(T));
+        u = byteswap(u);
+        std::memcpy(p, &u, sizeof(T));
+    }
+
+    template <typename B>
+    static void read(const B* p, T& t, std::false_type) noexcept
+    {
+        std::memcpy(&t, p, sizeof(T));
+    }
+
+    template <typename B>
+    static void read(const B* p, T& t, std::true_type) noexcept
+    {
+        typename unsigned_of_size<sizeof(T)>::type u;
+        std::memcpy(&u, p, sizeof(T));
+        u = byteswap(u);
+        std::memcpy(&t, &u, sizeof(T));
+    }
+};
+}
+
+template <typename Endian>
+struct serializable
+{
+    template <typename T, typename = void>
+    class modifier
+    {
+        static_assert(impl::always_false<T>,
+                      "Underlying type must be trivially copyable");
+    };
+};
+
+// Reads and writes the value as the sizeof(T) bytes of the underlying type,
+// in the byte order of Endian, with no padding or length. The buffers are
+// char, unsigned char, or from C++17 std::byte, with no alignment
+// requirement, and the caller makes sure they have room for the values.
+template <typename Endian>
+template <typename T, typename Tag, typename ... M>
+class serializable<Endian>::modifier<
+    ::strong::type<T, Tag, M...>,
+    std::enable_if_t<std::is_trivially_copyable<T>::value>
+>
+{
+    using type = ::strong::type<T, Tag, M...>;
+    using codec = impl::wire_codec<Endian, T>;
+public:
+    // The number of bytes written and read for one value.
+    STRONG_NODISCARD
+    static constexpr std::size_t wire_size() noexcept
+    {
+        return sizeof(T);
+    }
+
+    // Returns the position after the value.
+    template <typename B, typename = impl::if_byte<B>>
+    B* write_to(B* p) const noexcept
+    {
+        codec::write(p, value_of(static_cast<const type&>(*this)));
+        return p + sizeof(T);
+    }
+
+    template <typename B, typename = impl::if_byte<B>>
+    const B* read_from(const B* p) noexcept
+    {
+        codec::read(p, value_of(static_cast<type&>(*this)));
+        return p + sizeof(T);
+    }
+
+    // Bulk versions, for n values, found by argument dependent lookup.
+    template <typename B, typename = impl::if_byte<B>>
+    friend
+    B*
+    write_to(
+        B* p,
+        const type* values,
+        std::size_t n)
+    noexcept
+    {
+        codec::write_n(p, values, n);
+        return p + n * sizeof(T);
+    }
+
+    template <typename B, typename = impl::if_byte<B>>
+    friend
+    const B*
+    read_from(
+        const B* p,
+        type* values,
+        std::size_t n)
+    noexcept
+    {
+        codec::read_n(p, values, n);
+        return p + n * sizeof(T);
+    }
+
+#if defined(STRONG_TYPE_HAS_SPAN)
+    template <typename B, typename = impl::if_byte<B>>
+    friend
+    B*
+    write_to(
+        B* p,
+        std::span<const type> values)
+    noexcept
+    {
+        codec::write_n(p, values.data(), values.size());
+        return p + values.size() * sizeof(T);
+    }
+
+    template <typename B, typename = impl::if_byte<B>>
+    friend
+    const B*
+    read_from(
+        const B* p,
+        std::span<type> values)
+    noexcept
+    {
+        codec::read_n(p, values.data(), values.size());
+        return p + values.size() * sizeof(T);
+    }
+#endif
+};
+
+// The number of bytes a serializable strong type is written as.
+template <typename S>
+constexpr std::size_t wire_size_v = S::wire_size();
+}
+
+#endif //STRONG_TYPE_SERIALIZABLE_HPP
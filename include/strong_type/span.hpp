@@ -0,0 +1,83 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_SPAN_HPP
+#define STRONG_TYPE_SPAN_HPP
+
+#include "type.hpp"
+
+#if __has_include(<span>)
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <span>
+#endif
+#endif
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+#define STRONG_TYPE_HAS_SPAN 1
+
+namespace strong
+{
+namespace impl
+{
+// A strong type can be viewed as its underlying type, and the other way
+// around, if the only thing it holds is the underlying value.
+template <typename S>
+struct span_compatible
+{
+    using U = underlying_type_t<S>;
+    static constexpr bool value = is_strong_type<S>::value
+                                  && std::is_standard_layout<S>::value
+                                  && sizeof(S) == sizeof(U)
+                                  && alignof(S) == alignof(U);
+    static_assert(is_strong_type<S>::value, "Type must be a strong::type");
+    static_assert(std::is_standard_layout<S>::value, "Strong type must be standard layout");
+    static_assert(sizeof(S) == sizeof(U), "Strong type must be the size of its underlying type");
+    static_assert(alignof(S) == alignof(U), "Strong type must have the alignment of its underlying type");
+};
+
+template <typename From, typename To>
+using copy_const_t = std::conditional_t<std::is_const<From>::value, const To, To>;
+}
+
+// View a span of strong values as a span of their underlying values, without
+// copying. The underlying value of a standard layout strong type is at the
+// address of the strong type, so the view aliases the same memory.
+template <typename S, std::size_t N>
+STRONG_NODISCARD
+std::span<impl::copy_const_t<S, underlying_type_t<std::remove_const_t<S>>>, N>
+as_underlying(std::span<S, N> s)
+noexcept
+{
+    using U = impl::copy_const_t<S, underlying_type_t<std::remove_const_t<S>>>;
+    static_assert(impl::span_compatible<std::remove_const_t<S>>::value);
+    return std::span<U, N>(reinterpret_cast<U*>(s.data()), s.size());
+}
+
+// View a span of underlying values as a span of strong values, without
+// copying. The span is const if the underlying values are.
+template <typename S, typename T, std::size_t N>
+STRONG_NODISCARD
+std::span<impl::copy_const_t<T, std::remove_const_t<S>>, N>
+as_strong(std::span<T, N> s)
+noexcept
+{
+    using R = impl::copy_const_t<T, std::remove_const_t<S>>;
+    static_assert(std::is_same<std::remove_const_t<T>, underlying_type_t<std::remove_const_t<S>>>::value,
+                  "Span element type must be the underlying type of the strong type");
+    static_assert(impl::span_compatible<std::remove_const_t<S>>::value);
+    return std::span<R, N>(reinterpret_cast<R*>(s.data()), s.size());
+}
+}
+#endif
+
+#endif //STRONG_TYPE_SPAN_HPP
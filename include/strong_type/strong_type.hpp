@@ -28,6 +28,8 @@
 #include "boolean.hpp"
 #include "pointer.hpp"
 #include "hashable.hpp"
+#include "transparent.hpp"
+#include "cached_hash.hpp"
 #include "difference.hpp"
 #include "affine_point.hpp"
 #include "arithmetic.hpp"
@@ -38,7 +40,11 @@
 #include "convertible_to.hpp"
 #include "implicitly_convertible_to.hpp"
 #include "formattable.hpp"
+#include "charconv.hpp"
+#include "serializable.hpp"
 #include "scalable_with.hpp"
 #include "saturating_arithmetic.hpp"
+#include "checked_arithmetic.hpp"
+#include "wrapping_arithmetic.hpp"
 
 #endif //ROLLBEAR_STRONG_TYPE_HPP_INCLUDED
@@ -0,0 +1,165 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_TRANSPARENT_HPP
+#define STRONG_TYPE_TRANSPARENT_HPP
+
+#include "hashable.hpp"
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <string>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+#endif
+
+// Function objects for heterogeneous lookup in containers with a strong
+// type S as key, so that e.g. a std::unordered_map<user_name, V> with
+// std::string as the underlying type can be searched with a
+// std::string_view, without constructing a key.
+//
+// A type K can be used for lookup if S has a comparison with it, from e.g.
+// strong::equality_with<K> or strong::ordered_with<K>. For hashing, K must
+// also be guaranteed to hash like the underlying type T of S when they
+// compare equal, which is only the case for T itself, and for a
+// std::basic_string_view of a std::basic_string. A character pointer, e.g.
+// a string literal, is hashed as a std::basic_string_view when T is a
+// std::basic_string. Other keys, e.g. an int for a long long, do not hash
+// like T in general, and are rejected rather than risk lookups that miss.
+
+namespace strong
+{
+namespace impl
+{
+// The type a lookup key K is hashed as, for a strong type with underlying
+// type T.
+template <typename T, typename K>
+struct hash_key
+{
+    using type = K;
+    static const K& get(const K& k) noexcept { return k; }
+};
+
+template <typename C, typename Tr, typename A, typename P>
+struct hash_key<std::basic_string<C, Tr, A>, P*>
+{
+#if defined(__cpp_lib_string_view)
+    using type = std::conditional_t<std::is_same<std::remove_cv_t<P>, C>::value,
+                                    std::basic_string_view<C, Tr>,
+                                    P*>;
+#else
+    using type = std::conditional_t<std::is_same<std::remove_cv_t<P>, C>::value,
+                                    std::basic_string<C, Tr, A>,
+                                    P*>;
+#endif
+    static type get(P* p) { return type(p); }
+};
+
+template <typename T, typename K>
+using hash_key_for = hash_key<T, std::decay_t<const K>>;
+
+// Whether a K that compares equal to a T always hashes equal to it.
+template <typename T, typename K>
+struct hashes_like : std::is_same<T, K> {};
+
+#if defined(__cpp_lib_string_view)
+template <typename C, typename Tr, typename A>
+struct hashes_like<std::basic_string<C, Tr, A>, std::basic_string_view<C, Tr>> : std::true_type {};
+#endif
+
+// The hasher to use for K, given the hasher H of a strong type. If the
+// strong type uses std::hash for its underlying type, K is hashed with
+// std::hash<K>. A hasher from hashable_with is used as is.
+template <typename H, typename K>
+struct hasher_for
+{
+    using type = H;
+};
+
+template <typename T, typename K>
+struct hasher_for<std::hash<T>, K>
+{
+    using type = std::hash<K>;
+};
+
+template <typename S, typename K>
+using WhenTransparentHashKey = std::enable_if_t<
+    !std::is_same<std::decay_t<K>, S>::value
+    && hashes_like<underlying_type_t<S>, typename hash_key_for<underlying_type_t<S>, K>::type>::value,
+    decltype(std::declval<const S&>() == std::declval<const K&>())>;
+
+template <typename S, typename A, typename B>
+using WhenEitherIs = std::enable_if_t<std::is_same<std::decay_t<A>, S>::value
+                                      || std::is_same<std::decay_t<B>, S>::value>;
+}
+
+template <typename S>
+struct transparent_hash
+{
+    static_assert(is_strong_type<S>::value, "transparent_hash is for strong types");
+
+    using is_transparent = void;
+
+    STRONG_NODISCARD
+    std::size_t operator()(const S& s) const
+    noexcept(noexcept(std::hash<S>{}(s)))
+    {
+        return std::hash<S>{}(s);
+    }
+
+    template <typename K,
+              typename = impl::WhenTransparentHashKey<S, K>,
+              typename Key = impl::hash_key_for<underlying_type_t<S>, K>,
+              typename H = typename impl::hasher_for<impl::hasher_t<S>, typename Key::type>::type>
+    STRONG_NODISCARD
+    std::size_t operator()(const K& k) const
+    noexcept(noexcept(H{}(Key::get(k))))
+    {
+        return H{}(Key::get(k));
+    }
+};
+
+template <typename S>
+struct transparent_equal
+{
+    static_assert(is_strong_type<S>::value, "transparent_equal is for strong types");
+
+    using is_transparent = void;
+
+    template <typename A, typename B, typename = impl::WhenEitherIs<S, A, B>>
+    STRONG_NODISCARD
+    constexpr bool operator()(const A& a, const B& b) const
+    noexcept(noexcept(a == b))
+    {
+        return a == b;
+    }
+};
+
+template <typename S>
+struct transparent_less
+{
+    static_assert(is_strong_type<S>::value, "transparent_less is for strong types");
+
+    using is_transparent = void;
+
+    template <typename A, typename B, typename = impl::WhenEitherIs<S, A, B>>
+    STRONG_NODISCARD
+    constexpr bool operator()(const A& a, const B& b) const
+    noexcept(noexcept(a < b))
+    {
+        return a < b;
+    }
+};
+}
+
+#endif //STRONG_TYPE_TRANSPARENT_HPP
@@ -15,7 +15,10 @@
 #define ROLLBEAR_STRONG_TYPE_TYPE_HPP_INCLUDED
 
 #if defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#if !defined(STRONG_TYPE_MODULE)
+    // the module interface unit imports std itself, before its purview
     import std;
+#endif
 #else
 
     #include <type_traits>
@@ -42,6 +45,29 @@
 #define STRONG_EMPTY_BASES
 #endif
 
+// [[clang::trivial_abi]] lets a strong type around, e.g., a std::unique_ptr
+// from libc++ be passed in registers. It changes the calling convention, so
+// it is only used if STRONG_TRIVIAL_ABI is defined to non-zero.
+#if defined(STRONG_TRIVIAL_ABI) && STRONG_TRIVIAL_ABI && defined(__has_cpp_attribute)
+#if __has_cpp_attribute(clang::trivial_abi)
+#define STRONG_TRIVIAL_ABI_ATTRIBUTE [[clang::trivial_abi]]
+#endif
+#endif
+#if !defined(STRONG_TRIVIAL_ABI_ATTRIBUTE)
+#define STRONG_TRIVIAL_ABI_ATTRIBUTE
+#endif
+
+// P2786 trivial relocation. A strong type is trivially relocatable when its
+// underlying type and modifiers are. (P1144 implementations infer this
+// without help, since strong::type declares no special members.)
+#if defined(__cpp_trivial_relocatability)
+#define STRONG_TRIVIALLY_RELOCATABLE_IF_ELIGIBLE trivially_relocatable_if_eligible
+#else
+#define STRONG_TRIVIALLY_RELOCATABLE_IF_ELIGIBLE
+#endif
+
+#include "fwd.hpp"
+
 namespace strong {
 struct uninitialized_t {
 };
@@ -57,6 +83,11 @@ struct default_constructible {
     };
 };
 
+struct default_uninitialized {
+    template<typename T>
+    class modifier;
+};
+
 namespace impl {
     template<typename ...>
 using void_t = void;
@@ -84,10 +115,31 @@ struct limiter<M, T, U, impl::void_t<decltype(M::template modifier<T>::limit(std
     static constexpr void limit(U& u) { M::template modifier<T>::limit(u);}
 };
 
+// A modifier that must know when the value may change, e.g. to drop something
+// it has cached, provides a hidden friend strong_mutable_access(type&), which
+// is called whenever a non-const reference to the value is handed out.
+template <typename T, typename = void>
+struct mutable_access
+{
+    static constexpr void notify(T&) noexcept {}
+};
+
+template <typename T>
+struct mutable_access<T, impl::void_t<decltype(strong_mutable_access(std::declval<T&>()))>>
+{
+    static constexpr void notify(T& t) noexcept { strong_mutable_access(t); }
+};
+
+#if defined(__cpp_concepts) && __cpp_concepts >= 202002L
+template <typename D, typename T, typename ... M>
+constexpr bool has_modifier
+    = (std::is_base_of<modifier<D, T>, modifier<M, T>>::value || ...);
+#endif
 }
 
 template<typename T, typename Tag, typename ... M>
-class STRONG_EMPTY_BASES type : public modifier<M, type<T, Tag, M...>> ... {
+class STRONG_TRIVIAL_ABI_ATTRIBUTE STRONG_EMPTY_BASES type STRONG_TRIVIALLY_RELOCATABLE_IF_ELIGIBLE
+    : public modifier<M, type<T, Tag, M...>> ... {
 public:
     template<typename TT = T, typename = std::enable_if_t<std::is_trivially_constructible<TT>{}>>
     explicit type(uninitialized_t)
@@ -95,6 +147,22 @@ public:
     {
     }
 
+#if defined(__cpp_concepts) && __cpp_concepts >= 202002L
+    // Constrained non-template constructors, since only a defaulted
+    // constructor can be trivial.
+    type()
+    requires impl::has_modifier<default_uninitialized, type, M...>
+    = default;
+
+    constexpr
+    type()
+    noexcept(noexcept(T{}))
+    requires (impl::supports_default_construction(static_cast<type *>(nullptr))
+              && !impl::has_modifier<default_uninitialized, type, M...>)
+        : _val{}
+    {
+    }
+#else
     template<typename type_ = type,
         bool = impl::supports_default_construction(
             static_cast<type_ *>(nullptr))>
@@ -104,6 +172,7 @@ public:
         : _val{}
     {
     }
+#endif
 
     template<typename U,
         typename = impl::WhenConstructible<T, std::initializer_list<U>>>
@@ -145,12 +214,17 @@ public:
     )
     {
         using std::swap;
+        impl::mutable_access<type>::notify(a);
+        impl::mutable_access<type>::notify(b);
         swap(a._val, b._val);
     }
 
     STRONG_NODISCARD
     constexpr T &value_of() & noexcept
-    { return _val; }
+    {
+        impl::mutable_access<type>::notify(*this);
+        return _val;
+    }
 
     STRONG_NODISCARD
     constexpr const T &value_of() const & noexcept
@@ -158,7 +232,10 @@ public:
 
     STRONG_NODISCARD
     constexpr T &&value_of() && noexcept
-    { return std::move(_val); }
+    {
+        impl::mutable_access<type>::notify(*this);
+        return std::move(_val);
+    }
 
     STRONG_NODISCARD
     constexpr const T &&value_of() const && noexcept
@@ -166,7 +243,10 @@ public:
 
     STRONG_NODISCARD
     friend constexpr T &value_of(type &t) noexcept
-    { return t._val; }
+    {
+        impl::mutable_access<type>::notify(t);
+        return t._val;
+    }
 
     STRONG_NODISCARD
     friend constexpr const T &value_of(const type &t) noexcept
@@ -174,7 +254,10 @@ public:
 
     STRONG_NODISCARD
     friend constexpr T &&value_of(type &&t) noexcept
-    { return std::move(t)._val; }
+    {
+        impl::mutable_access<type>::notify(t);
+        return std::move(t)._val;
+    }
 
     STRONG_NODISCARD
     friend constexpr const T &&value_of(const type &&t) noexcept
@@ -183,6 +266,14 @@ public:
     T _val;
 };
 
+template <typename T, typename Tag, typename ... M>
+class STRONG_EMPTY_BASES default_uninitialized::modifier<type<T, Tag, M...>>
+    : public default_constructible::modifier<type<T, Tag, M...>>
+{
+    static_assert(std::is_trivially_default_constructible<T>::value,
+                  "Underlying type must be trivially default constructible");
+};
+
 namespace impl {
 template<typename T, typename Tag, typename ... Ms>
 constexpr bool is_strong_type_func(const strong::type<T, Tag, Ms...> *)
@@ -202,6 +293,54 @@ struct is_strong_type : std::integral_constant<bool, impl::is_strong_type_func(
 };
 
 
+namespace impl {
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_cpp_trivially_relocatable)
+#define STRONG_BUILTIN_IS_TRIVIALLY_RELOCATABLE(T) __builtin_is_cpp_trivially_relocatable(T)
+#elif __has_builtin(__is_trivially_relocatable)
+#define STRONG_BUILTIN_IS_TRIVIALLY_RELOCATABLE(T) __is_trivially_relocatable(T)
+#endif
+#endif
+
+template <typename T>
+constexpr bool builtin_is_trivially_relocatable
+#if defined(STRONG_BUILTIN_IS_TRIVIALLY_RELOCATABLE)
+    = STRONG_BUILTIN_IS_TRIVIALLY_RELOCATABLE(T);
+#else
+    = std::is_trivially_copyable<T>::value && std::is_trivially_destructible<T>::value;
+#endif
+
+template <bool ...>
+struct bools {};
+
+template <typename ... Ts>
+constexpr bool all_builtin_trivially_relocatable
+    = std::is_same<bools<true, builtin_is_trivially_relocatable<Ts>...>,
+                   bools<builtin_is_trivially_relocatable<Ts>..., true>>::value;
+}
+
+// is_trivially_relocatable<T> tells if a T can be moved to new storage by
+// copying its bytes, without running the move constructor and destructor.
+// It uses the compiler's opinion where there is one, and is_trivially_copyable
+// otherwise. Specialize it for your own types, e.g. move only handles, and
+// the strong types wrapping them follow.
+template <typename T>
+struct is_trivially_relocatable
+    : std::integral_constant<bool, impl::builtin_is_trivially_relocatable<T>>
+{
+};
+
+template <typename T, typename Tag, typename ... M>
+struct is_trivially_relocatable<type<T, Tag, M...>>
+    : std::integral_constant<bool,
+        is_trivially_relocatable<T>::value
+        && impl::all_builtin_trivially_relocatable<modifier<M, type<T, Tag, M...>>...>>
+{
+};
+
+template <typename T>
+constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
 template<typename T, bool = is_strong_type<T>::value>
 struct underlying_type {
     using type = decltype(impl::underlying_type(static_cast<T *>(nullptr)));
@@ -367,24 +506,69 @@ type_implements<Modifier<Needles...>, Type, Modifier<Haystack...>>
     >::value;
 #endif
 
+// is_listed<M, Ms...> is true if M is literally one of Ms. It is cheap, since
+// it never instantiates any modifier.
+#if __cplusplus >= 201703L
+template <typename M, typename ... Ms>
+constexpr bool is_listed = (std::is_same<M, Ms>::value || ...);
+#else
+template <typename M, typename ... Ms>
+constexpr bool is_listed = disjunction<std::is_same<M, Ms>...>::value;
+#endif
+
+// implements_any<T, M> checks if any of the modifiers of T is, or is built
+// from, M. This is needed for composite modifiers, like strong::regular,
+// and for variadic modifiers, like strong::ordered_with<Ts...>, but it
+// instantiates every modifier of T, so type_is only uses it when the cheap
+// is_listed<> check fails.
 template <typename T, typename M>
-constexpr bool type_is = false;
+struct implements_any;
 
 #if __cplusplus >= 201703L
 template <typename T, typename Tag, typename ... Ms, typename M>
-constexpr bool type_is<strong::type<T, Tag, Ms...>, M>
-    = (impl::type_implements<M, strong::type<T, Tag, Ms...>, Ms> || ...);
+struct implements_any<strong::type<T, Tag, Ms...>, M>
+    : std::integral_constant<bool, (impl::type_implements<M, strong::type<T, Tag, Ms...>, Ms> || ...)>
+{
+};
 #else
 template <typename T, typename Tag, typename ... Ms, typename M>
-constexpr bool type_is<strong::type<T, Tag, Ms...>, M>
-    = impl::disjunction<std::integral_constant<bool, impl::type_implements<M, strong::type<T, Tag, Ms...>, Ms>>...>::value;
+struct implements_any<strong::type<T, Tag, Ms...>, M>
+    : impl::disjunction<std::integral_constant<bool, impl::type_implements<M, strong::type<T, Tag, Ms...>, Ms>>...>
+{
+};
 #endif
 
+template <typename T, typename M>
+constexpr bool type_is = false;
+
+template <typename T, typename Tag, typename ... Ms, typename M>
+constexpr bool type_is<strong::type<T, Tag, Ms...>, M>
+    = std::conditional_t<
+        is_listed<M, Ms...>,
+        std::true_type,
+        implements_any<strong::type<T, Tag, Ms...>, M>
+    >::value;
+
 template <typename T, typename Tag, typename ... Ms>
 type<T, Tag, Ms...> get_strong_(const type<T, Tag, Ms...>*);
 
+// get_strong_() finds the strong::type base of a derived type, but overload
+// resolution requires a complete type, so the common case of T being a
+// strong::type is short-circuited to not instantiate it.
+template <typename T>
+struct get_strong_type
+{
+    using type = decltype(get_strong_(static_cast<T*>(nullptr)));
+};
+
+template <typename T, typename Tag, typename ... Ms>
+struct get_strong_type<type<T, Tag, Ms...>>
+{
+    using type = ::strong::type<T, Tag, Ms...>;
+};
+
 template <typename T>
-using get_strong = decltype(get_strong_(static_cast<T*>(nullptr)));
+using get_strong = typename get_strong_type<T>::type;
 }
 
 template <typename T, typename M>
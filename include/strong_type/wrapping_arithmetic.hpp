@@ -0,0 +1,233 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef STRONG_TYPE_WRAPPING_ARITHMETIC_HPP
+#define STRONG_TYPE_WRAPPING_ARITHMETIC_HPP
+
+#include "type.hpp"
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <limits>
+#endif
+
+namespace strong
+{
+namespace impl
+{
+template <typename T>
+using WhenWrappingInteger = std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>;
+
+// The unsigned type the operations are done in. It is at least unsigned int,
+// since narrower unsigned types are promoted to int, where e.g.
+// 0xffff * 0xffff overflows.
+template <typename T>
+using wrapping_unsigned_t = decltype(std::make_unsigned_t<T>{} + 0U);
+
+template <typename T>
+constexpr T wrapping_add(T a, T b) noexcept
+{
+    using U = wrapping_unsigned_t<T>;
+    return static_cast<T>(static_cast<U>(static_cast<U>(a) + static_cast<U>(b)));
+}
+
+template <typename T>
+constexpr T wrapping_sub(T a, T b) noexcept
+{
+    using U = wrapping_unsigned_t<T>;
+    return static_cast<T>(static_cast<U>(static_cast<U>(a) - static_cast<U>(b)));
+}
+
+template <typename T>
+constexpr T wrapping_mul(T a, T b) noexcept
+{
+    using U = wrapping_unsigned_t<T>;
+    return static_cast<T>(static_cast<U>(static_cast<U>(a) * static_cast<U>(b)));
+}
+
+// min / -1 is the only division that overflows. It wraps to min, and
+// min % -1 is 0.
+template <typename T>
+constexpr bool division_overflows(T a, T b) noexcept
+{
+    return std::is_signed<T>::value
+           && a == std::numeric_limits<T>::min()
+           && b == static_cast<T>(~T{});
+}
+
+template <typename T>
+constexpr T wrapping_div(T a, T b) noexcept
+{
+    return division_overflows(a, b) ? a : static_cast<T>(a / b);
+}
+
+template <typename T>
+constexpr T wrapping_mod(T a, T b) noexcept
+{
+    return division_overflows(a, b) ? T{} : static_cast<T>(a % b);
+}
+}
+
+struct wrapping_arithmetic
+{
+    template <typename T, typename = void>
+    class modifier
+    {
+        static_assert(impl::always_false<T>,
+                      "Underlying type must be an integer type");
+    };
+};
+
+template <typename T, typename Tag, typename ... M>
+class wrapping_arithmetic::modifier<::strong::type<T, Tag, M...>, impl::WhenWrappingInteger<T>>
+{
+    using type = ::strong::type<T, Tag, M...>;
+public:
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator-(
+        const type &lh)
+    noexcept
+    {
+        return type{impl::wrapping_sub(T{}, value_of(lh))};
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator+=(
+        type &lh,
+        const type &rh)
+    noexcept
+    {
+        value_of(lh) = impl::wrapping_add(value_of(lh), value_of(rh));
+        return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator-=(
+        type &lh,
+        const type &rh)
+    noexcept
+    {
+        value_of(lh) = impl::wrapping_sub(value_of(lh), value_of(rh));
+        return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator*=(
+        type &lh,
+        const type &rh)
+    noexcept
+    {
+        value_of(lh) = impl::wrapping_mul(value_of(lh), value_of(rh));
+        return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator/=(
+        type &lh,
+        const type &rh)
+    noexcept
+    {
+        value_of(lh) = impl::wrapping_div(value_of(lh), value_of(rh));
+        return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator%=(
+        type &lh,
+        const type &rh)
+    noexcept
+    {
+        value_of(lh) = impl::wrapping_mod(value_of(lh), value_of(rh));
+        return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator+(
+        type lh,
+        const type &rh)
+    noexcept
+    {
+        lh += rh;
+        return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator-(
+        type lh,
+        const type &rh)
+    noexcept
+    {
+        lh -= rh;
+        return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator*(
+        type lh,
+        const type &rh)
+    noexcept
+    {
+        lh *= rh;
+        return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator/(
+        type lh,
+        const type &rh)
+    noexcept
+    {
+        lh /= rh;
+        return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator%(
+        type lh,
+        const type &rh)
+    noexcept
+    {
+        lh %= rh;
+        return lh;
+    }
+};
+}
+
+#endif //STRONG_TYPE_WRAPPING_ARITHMETIC_HPP
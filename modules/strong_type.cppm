@@ -0,0 +1,83 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+// Module interface unit for "import strong_type;"
+//
+// All standard library and {fmt} headers that strong_type uses are included
+// in the global module fragment, so that their include guards make the
+// corresponding #includes in the strong_type headers no-ops when they are
+// included in the module purview below.
+
+module;
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#if __has_include(<version>)
+#include <version>
+#endif
+#if __has_include(<ranges>)
+#include <ranges>
+#endif
+#if __has_include(<string_view>)
+#include <string_view>
+#endif
+#if __has_include(<span>)
+#include <span>
+#endif
+#if defined(__cpp_lib_format) && __cpp_lib_format >= 201907
+#include <format>
+#endif
+#endif
+
+#if defined(__SSE2__) && !defined(STRONG_TYPE_NO_INTRINSICS)
+#include <emmintrin.h>
+#endif
+
+#if !defined(STRONG_HAS_FMT_FORMAT) && __has_include(<fmt/format.h>)
+#define STRONG_HAS_FMT_FORMAT 1
+#endif
+#if STRONG_HAS_FMT_FORMAT
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#endif
+
+export module strong_type;
+
+#if defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+import std;
+#endif
+
+#define STRONG_TYPE_MODULE 1
+
+export extern "C++" {
+#include "strong_type/strong_type.hpp"
+}
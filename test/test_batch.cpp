@@ -0,0 +1,132 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#include <strong_type/batch.hpp>
+#include <strong_type/arithmetic.hpp>
+#include <strong_type/affine_point.hpp>
+#include <strong_type/scalable_with.hpp>
+#include <strong_type/regular.hpp>
+
+namespace {
+using meters = strong::type<float, struct meters_, strong::arithmetic, strong::regular>;
+using seconds = strong::type<float, struct seconds_, strong::arithmetic, strong::regular>;
+using duration = strong::type<int, struct duration_, strong::difference>;
+using timestamp = strong::type<int, struct timestamp_, strong::affine_point<duration>>;
+using gain = strong::type<float, struct gain_, strong::scalable_with<float>, strong::regular>;
+
+template <typename A, typename B, typename = void>
+struct can_add : std::false_type {};
+template <typename A, typename B>
+struct can_add<A, B, strong::impl::void_t<decltype(std::declval<A>() + std::declval<B>())>> : std::true_type {};
+
+template <typename A, typename B, typename = void>
+struct can_multiply : std::false_type {};
+template <typename A, typename B>
+struct can_multiply<A, B, strong::impl::void_t<decltype(std::declval<A>() * std::declval<B>())>> : std::true_type {};
+}
+
+static_assert(can_add<strong::batch<meters, 4>, strong::batch<meters, 4>>{}, "");
+static_assert(!can_add<strong::batch<meters, 4>, strong::batch<seconds, 4>>{}, "");
+static_assert(!can_add<strong::batch<meters, 4>, strong::batch<float, 4>>{}, "");
+static_assert(!can_add<strong::batch<meters, 4>, float>{}, "");
+static_assert(!can_add<strong::batch<meters, 4>, strong::batch<meters, 8>>{}, "");
+static_assert(!can_add<strong::batch<timestamp, 4>, strong::batch<timestamp, 4>>{}, "");
+static_assert(can_multiply<strong::batch<gain, 4>, float>{}, "");
+static_assert(!can_multiply<strong::batch<gain, 4>, strong::batch<gain, 4>>{}, "");
+static_assert(sizeof(strong::batch<meters, 4>) == 4 * sizeof(float), "");
+static_assert(strong::simd_width<meters> * sizeof(float) == STRONG_SIMD_BYTES, "");
+static_assert(std::is_same<strong::simd<meters>, strong::batch<meters, strong::simd_width<meters>>>{}, "");
+
+TEST_CASE("a batch can be loaded and stored")
+{
+    const meters in[] = {meters{1}, meters{2}, meters{3}, meters{4}};
+    auto b = strong::batch<meters, 4>::load(in);
+    REQUIRE(b.size() == 4U);
+    REQUIRE(b[2] == meters{3});
+    meters out[4] = {meters{0}, meters{0}, meters{0}, meters{0}};
+    b.store(out);
+    REQUIRE(out[3] == meters{4});
+}
+
+TEST_CASE("a batch constructed from a value has it in every lane")
+{
+    strong::batch<meters, 3> b{meters{2}};
+    REQUIRE(b[0] == meters{2});
+    REQUIRE(b[1] == meters{2});
+    REQUIRE(b[2] == meters{2});
+}
+
+TEST_CASE("arithmetic batches are added, subtracted, multiplied and divided lane by lane")
+{
+    const meters a_in[] = {meters{1}, meters{2}, meters{3}, meters{4}};
+    const meters b_in[] = {meters{8}, meters{6}, meters{4}, meters{2}};
+    auto a = strong::batch<meters, 4>::load(a_in);
+    auto b = strong::batch<meters, 4>::load(b_in);
+
+    auto sum = a + b;
+    STATIC_REQUIRE(std::is_same<decltype(sum), strong::batch<meters, 4>>{});
+    REQUIRE(sum[0] == meters{9});
+    REQUIRE(sum[3] == meters{6});
+    auto diff = b - a;
+    REQUIRE(diff[1] == meters{4});
+    auto product = a * b;
+    REQUIRE(product[2] == meters{12});
+    auto quotient = b / a;
+    REQUIRE(quotient[3] == meters{0.5f});
+    auto negated = -a;
+    REQUIRE(negated[1] == meters{-2});
+    auto scaled = a * meters{2};
+    REQUIRE(scaled[3] == meters{8});
+    a += b;
+    REQUIRE(a[0] == meters{9});
+    a -= meters{1};
+    REQUIRE(a[0] == meters{8});
+    REQUIRE(strong::reduce_add(a) == meters{26});
+}
+
+TEST_CASE("batches of affine points give batches of differences")
+{
+    const timestamp t1_in[] = {timestamp{10}, timestamp{20}};
+    const timestamp t2_in[] = {timestamp{15}, timestamp{21}};
+    auto t1 = strong::batch<timestamp, 2>::load(t1_in);
+    auto t2 = strong::batch<timestamp, 2>::load(t2_in);
+    auto d = t2 - t1;
+    STATIC_REQUIRE(std::is_same<decltype(d), strong::batch<duration, 2>>{});
+    REQUIRE(value_of(d[0]) == 5);
+    REQUIRE(value_of(d[1]) == 1);
+    auto t3 = t1 + d;
+    STATIC_REQUIRE(std::is_same<decltype(t3), strong::batch<timestamp, 2>>{});
+    REQUIRE(value_of(t3[1]) == 21);
+    t1 += duration{1};
+    REQUIRE(value_of(t1[0]) == 11);
+}
+
+TEST_CASE("batches of scalable types are scaled by the scalar type")
+{
+    strong::batch<gain, 4> g{gain{2}};
+    auto h = g * 1.5f;
+    STATIC_REQUIRE(std::is_same<decltype(h), strong::batch<gain, 4>>{});
+    REQUIRE(h[3] == gain{3});
+    g /= 2.0f;
+    REQUIRE(g[0] == gain{1});
+}
+
+TEST_CASE("value_of a batch is the array of underlying values")
+{
+    strong::batch<meters, 2> b{meters{3}};
+    value_of(b)[1] = 5.0f;
+    REQUIRE(b[1] == meters{5});
+    STATIC_REQUIRE(std::is_same<decltype(value_of(b)), std::array<float, 2>&>{});
+}
@@ -0,0 +1,160 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#include <strong_type/cached_hash.hpp>
+#include <strong_type/equality.hpp>
+#include <strong_type/equality_with.hpp>
+#include <strong_type/regular.hpp>
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#endif
+
+namespace {
+// A hash that counts how many times it is called.
+struct counted
+{
+    std::string s;
+    friend bool operator==(const counted& a, const counted& b) { return a.s == b.s; }
+    friend bool operator!=(const counted& a, const counted& b) { return a.s != b.s; }
+    static int& calls()
+    {
+        static int n = 0;
+        return n;
+    }
+};
+}
+
+namespace std {
+template <>
+struct hash<counted>
+{
+    std::size_t operator()(const counted& c) const
+    {
+        ++counted::calls();
+        return std::hash<std::string>{}(c.s);
+    }
+};
+}
+
+namespace {
+using key = strong::type<counted, struct key_, strong::regular, strong::cached_hash>;
+using name = strong::type<std::string, struct name_, strong::regular, strong::cached_hash, strong::equality_with<std::string>>;
+}
+
+TEST_CASE("the hash of a cached_hash type is std::hash of the value, computed once")
+{
+    counted::calls() = 0;
+    const key k{counted{"foo"}};
+    REQUIRE(counted::calls() == 0);
+    REQUIRE(std::hash<key>{}(k) == std::hash<std::string>{}("foo"));
+    REQUIRE(std::hash<key>{}(k) == std::hash<std::string>{}("foo"));
+    REQUIRE(k.hash() == std::hash<std::string>{}("foo"));
+    REQUIRE(counted::calls() == 1);
+}
+
+TEST_CASE("the cached hash is recomputed after mutable access to the value")
+{
+    key k{counted{"foo"}};
+    counted::calls() = 0;
+    (void)std::hash<key>{}(k);
+    value_of(k).s = "bar";
+    REQUIRE(std::hash<key>{}(k) == std::hash<std::string>{}("bar"));
+    REQUIRE(counted::calls() == 2);
+    key other{counted{"baz"}};
+    (void)std::hash<key>{}(other);
+    swap(k, other);
+    REQUIRE(std::hash<key>{}(k) == std::hash<std::string>{}("baz"));
+    REQUIRE(std::hash<key>{}(other) == std::hash<std::string>{}("bar"));
+}
+
+TEST_CASE("a copy has the hash, and a moved from value does not")
+{
+    key k{counted{"foo"}};
+    (void)std::hash<key>{}(k);
+    counted::calls() = 0;
+    key copy = k;
+    REQUIRE(std::hash<key>{}(copy) == std::hash<std::string>{}("foo"));
+    REQUIRE(counted::calls() == 0);
+    key moved = std::move(k);
+    REQUIRE(std::hash<key>{}(moved) == std::hash<std::string>{}("foo"));
+    REQUIRE(counted::calls() == 0);
+    k = key{counted{"bar"}};
+    REQUIRE(std::hash<key>{}(k) == std::hash<std::string>{}("bar"));
+    REQUIRE(counted::calls() == 1);
+}
+
+TEST_CASE("cached_hash_equal tells values with different cached hashes apart without comparing values")
+{
+    const strong::cached_hash_equal<key> eq;
+    const key a{counted{"foo"}};
+    key b{counted{"bar"}};
+    const key c{counted{"foo"}};
+    REQUIRE_FALSE(eq(a, b));
+    REQUIRE(eq(a, c));
+    (void)a.hash();
+    (void)b.hash();
+    (void)c.hash();
+    value_of(b).s = "foo";
+    (void)b.hash();
+    REQUIRE(eq(a, b));
+    REQUIRE(eq(a, c));
+    std::unordered_set<key, std::hash<key>, strong::cached_hash_equal<key>> s{a, key{counted{"baz"}}};
+    REQUIRE(s.count(c) == 1U);
+    REQUIRE(s.count(key{counted{"qux"}}) == 0U);
+}
+
+// A reference to the value kept from before the hash is computed leaves a
+// stale hash when written to. == compares the values anyway.
+TEST_CASE("equality compares values also when a cached hash is stale")
+{
+    name x{"foo"};
+    const name other{"bar"};
+    auto& r = value_of(x);
+    (void)x.hash();
+    (void)other.hash();
+    r = "bar";
+    REQUIRE(x.hash() == std::hash<std::string>{}("foo"));
+    REQUIRE(x == other);
+    REQUIRE_FALSE(x != other);
+    REQUIRE(x == std::string("bar"));
+}
+
+TEST_CASE("a cached_hash type can be used in unordered containers, also with transparent lookup")
+{
+    std::unordered_set<name> s{name{"foo"}, name{"bar"}};
+    REQUIRE(s.count(name{"foo"}) == 1U);
+    REQUIRE(s.count(name{"baz"}) == 0U);
+    REQUIRE(strong::transparent_hash<name>{}(std::string("foo")) == strong::transparent_hash<name>{}(name{"foo"}));
+#if defined(__cpp_lib_generic_unordered_lookup)
+    std::unordered_map<name, int, strong::transparent_hash<name>, strong::transparent_equal<name>> m{{name{"foo"}, 1}};
+    REQUIRE(m.find(std::string("foo")) != m.end());
+#endif
+}
+
+namespace {
+using only_cached = strong::type<std::string, struct only_cached_, strong::cached_hash>;
+using cached_eq = strong::type<std::string, struct cached_eq_, strong::cached_hash, strong::equality>;
+}
+
+TEST_CASE("std::hash works when cached_hash is listed without regular")
+{
+    REQUIRE(std::hash<only_cached>{}(only_cached{"foo"}) == std::hash<std::string>{}("foo"));
+    std::unordered_set<cached_eq> s{cached_eq{"foo"}};
+    REQUIRE(s.count(cached_eq{"foo"}) == 1U);
+    REQUIRE(s.count(cached_eq{"bar"}) == 0U);
+}
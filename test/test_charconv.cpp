@@ -0,0 +1,121 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#include <strong_type/cached_hash.hpp>
+#include <strong_type/charconv.hpp>
+#include <strong_type/equality.hpp>
+
+#if STRONG_TYPE_HAS_CHARCONV
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <cstring>
+#include <string>
+#include <string_view>
+#endif
+
+namespace {
+using port = strong::type<unsigned short, struct port_, strong::charconv, strong::equality>;
+using offset = strong::type<long, struct offset_, strong::charconv, strong::equality>;
+using ratio = strong::type<double, struct ratio_, strong::charconv, strong::equality>;
+using plain = strong::type<int, struct plain_>;
+using hashed = strong::type<long, struct hashed_, strong::charconv, strong::equality, strong::cached_hash>;
+
+template <typename S, typename = void>
+struct can_parse : std::false_type {};
+template <typename S>
+struct can_parse<S, strong::impl::void_t<decltype(strong::parse<S>(std::string_view{}))>> : std::true_type {};
+}
+
+static_assert(can_parse<port>{});
+static_assert(!can_parse<plain>{});
+
+TEST_CASE("to_chars of a charconv type writes the underlying value")
+{
+    char buf[32];
+    auto r = to_chars(buf, buf + sizeof(buf), offset{-1234});
+    REQUIRE(r.ec == std::errc{});
+    REQUIRE(std::string(buf, r.ptr) == "-1234");
+    r = to_chars(buf, buf + sizeof(buf), offset{255}, 16);
+    REQUIRE(std::string(buf, r.ptr) == "ff");
+    r = to_chars(buf, buf + 2, offset{1000});
+    REQUIRE(r.ec == std::errc::value_too_large);
+}
+
+TEST_CASE("from_chars of a charconv type only changes it on success")
+{
+    const char text[] = "8080 rest";
+    port p{1};
+    auto r = from_chars(text, text + std::strlen(text), p);
+    REQUIRE(r.ec == std::errc{});
+    REQUIRE(r.ptr == text + 4);
+    REQUIRE(p == port{8080});
+    const char bad[] = "x";
+    r = from_chars(bad, bad + 1, p);
+    REQUIRE(r.ec == std::errc::invalid_argument);
+    REQUIRE(p == port{8080});
+    const char big[] = "70000";
+    r = from_chars(big, big + 5, p);
+    REQUIRE(r.ec == std::errc::result_out_of_range);
+    REQUIRE(p == port{8080});
+    const char hex[] = "1f";
+    r = from_chars(hex, hex + 2, p, 16);
+    REQUIRE(p == port{31});
+}
+
+TEST_CASE("from_chars goes through value_of, so a cached hash is updated")
+{
+    const char text[] = "42";
+    hashed h{1};
+    const auto before = h.hash();
+    auto r = from_chars(text, text + 2, h);
+    REQUIRE(r.ec == std::errc{});
+    REQUIRE(h == hashed{42});
+    REQUIRE(h.hash() == hashed{42}.hash());
+    REQUIRE(h.hash() != before);
+    const auto p = strong::parse<hashed>("7");
+    REQUIRE(p.value.hash() == hashed{7}.hash());
+}
+
+TEST_CASE("parse requires the whole string to be a value")
+{
+    auto r = strong::parse<offset>("-42");
+    REQUIRE(r);
+    REQUIRE(r.value == offset{-42});
+    r = strong::parse<offset>("42x");
+    REQUIRE_FALSE(r);
+    REQUIRE(r.ec == std::errc::invalid_argument);
+    REQUIRE(*r.ptr == 'x');
+    r = strong::parse<offset>("");
+    REQUIRE(r.ec == std::errc::invalid_argument);
+    r = strong::parse<offset>("ff", 16);
+    REQUIRE(r.value == offset{255});
+}
+
+#if defined(__cpp_lib_to_chars)
+TEST_CASE("floating point charconv types round trip")
+{
+    char buf[64];
+    const ratio x{0.1};
+    auto w = to_chars(buf, buf + sizeof(buf), x);
+    REQUIRE(w.ec == std::errc{});
+    const auto r = strong::parse<ratio>(std::string_view(buf, static_cast<std::size_t>(w.ptr - buf)));
+    REQUIRE(r);
+    REQUIRE(r.value == x);
+    w = to_chars(buf, buf + sizeof(buf), ratio{1.5}, std::chars_format::fixed, 2);
+    REQUIRE(std::string(buf, w.ptr) == "1.50");
+}
+#endif
+
+#endif
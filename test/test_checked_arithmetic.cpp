@@ -0,0 +1,163 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#include <strong_type/checked_arithmetic.hpp>
+
+#if CATCH2 == 3
+#include <catch2/catch_template_test_macros.hpp>
+#endif
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <cstdint>
+#include <string>
+#endif
+
+namespace {
+template <typename A, typename B, typename = void>
+struct can_add : std::false_type {};
+template <typename A, typename B>
+struct can_add<A, B, strong::impl::void_t<decltype(std::declval<A>() + std::declval<B>())>> : std::true_type {};
+
+using checked_int = strong::type<int, struct checked_int_, strong::checked_arithmetic<>>;
+using sticky_int = strong::type<int, struct sticky_int_, strong::checked_arithmetic<strong::sticky_overflow>>;
+
+struct logger
+{
+    static std::string& last()
+    {
+        static std::string s;
+        return s;
+    }
+    void operator()(const char* operation) const { last() = operation; }
+};
+using logged_int = strong::type<int, struct logged_int_, strong::checked_arithmetic<strong::log_and_wrap_on_overflow<logger>>>;
+}
+
+static_assert(std::is_same<strong::checked_arithmetic<>, strong::checked_arithmetic<strong::throw_on_overflow>>{}, "");
+static_assert(can_add<checked_int, checked_int>{}, "");
+static_assert(!can_add<checked_int, int>{}, "");
+static_assert(!can_add<checked_int, sticky_int>{}, "");
+static_assert(std::is_base_of<std::overflow_error, strong::overflow_error>{}, "");
+
+TEMPLATE_TEST_CASE("checked arithmetic without overflow gives the plain result", "[checked]",
+                   int, short, long long, signed char, unsigned char, unsigned)
+{
+    using type = strong::type<TestType, struct tag, strong::checked_arithmetic<>>;
+    REQUIRE(value_of(type{3} + type{4}) == 7);
+    REQUIRE(value_of(type{7} - type{4}) == 3);
+    REQUIRE(value_of(type{3} * type{4}) == 12);
+    REQUIRE(value_of(type{12} / type{4}) == 3);
+    type v{10};
+    v += type{5};
+    v -= type{3};
+    v *= type{2};
+    v /= type{4};
+    REQUIRE(value_of(v) == 6);
+}
+
+TEMPLATE_TEST_CASE("checked arithmetic throws on overflow with throw_on_overflow", "[checked]",
+                   int, short, long long, signed char, unsigned char, unsigned)
+{
+    using type = strong::type<TestType, struct tag, strong::checked_arithmetic<>>;
+    const auto max = type{std::numeric_limits<TestType>::max()};
+    const auto min = type{std::numeric_limits<TestType>::min()};
+    REQUIRE_THROWS_AS(max + type{1}, strong::overflow_error);
+    REQUIRE_THROWS_AS(min - type{1}, strong::overflow_error);
+    REQUIRE_THROWS_AS(max * type{2}, strong::overflow_error);
+    REQUIRE_THROWS_AS(type{1} / type{0}, strong::overflow_error);
+    type v = max;
+    REQUIRE_THROWS_AS(v += type{1}, strong::overflow_error);
+    REQUIRE(value_of(v) == value_of(max));
+    if (std::is_signed<TestType>::value)
+    {
+        REQUIRE_THROWS_AS(min / type{-1}, strong::overflow_error);
+        REQUIRE_THROWS_AS(min * type{-1}, strong::overflow_error);
+        REQUIRE_THROWS_AS(-min, strong::overflow_error);
+        REQUIRE(value_of(-max) == -std::numeric_limits<TestType>::max());
+    }
+    else
+    {
+        REQUIRE_THROWS_AS(-type{1}, strong::overflow_error);
+        REQUIRE(value_of(-type{0}) == 0);
+    }
+}
+
+TEST_CASE("the overflow error names the operation")
+{
+    const auto max = checked_int{std::numeric_limits<int>::max()};
+    try
+    {
+        (void)(max * checked_int{3});
+        FAIL("no exception thrown");
+    }
+    catch (const strong::overflow_error& e)
+    {
+        REQUIRE(std::string(e.what()) == "*");
+    }
+}
+
+TEST_CASE("sticky_overflow wraps and remembers that an overflow occurred")
+{
+    strong::sticky_overflow::clear();
+    const auto max = sticky_int{std::numeric_limits<int>::max()};
+    auto v = sticky_int{1} + sticky_int{2};
+    REQUIRE(value_of(v) == 3);
+    REQUIRE_FALSE(strong::sticky_overflow::occurred());
+    v = max + sticky_int{1};
+    REQUIRE(value_of(v) == std::numeric_limits<int>::min());
+    REQUIRE(strong::sticky_overflow::occurred());
+    v = sticky_int{1} + sticky_int{2};
+    REQUIRE(strong::sticky_overflow::occurred());
+    strong::sticky_overflow::clear();
+    REQUIRE_FALSE(strong::sticky_overflow::occurred());
+}
+
+TEST_CASE("log_and_wrap_on_overflow calls the logger and gives the wrapped result")
+{
+    logger::last().clear();
+    const auto v = logged_int{std::numeric_limits<int>::min()} - logged_int{1};
+    REQUIRE(value_of(v) == std::numeric_limits<int>::max());
+    REQUIRE(logger::last() == "-");
+}
+
+namespace {
+template <typename T>
+void check_overflow_exhaustively()
+{
+    constexpr int min = std::numeric_limits<T>::min();
+    constexpr int max = std::numeric_limits<T>::max();
+    auto overflows = [&](int v) { return v < min || v > max; };
+    int wrong = 0;
+    for (int a = min; a <= max; ++a)
+    {
+        for (int b = min; b <= max; ++b)
+        {
+            const auto ta = static_cast<T>(a);
+            const auto tb = static_cast<T>(b);
+            T r{};
+            wrong += strong::impl::add_overflow(ta, tb, r) != overflows(a + b) || r != static_cast<T>(a + b);
+            wrong += strong::impl::sub_overflow(ta, tb, r) != overflows(a - b) || r != static_cast<T>(a - b);
+            wrong += strong::impl::mul_overflow(ta, tb, r) != overflows(a * b) || r != static_cast<T>(a * b);
+        }
+    }
+    REQUIRE(wrong == 0);
+}
+}
+
+TEST_CASE("overflow detection is exact for 8 bit types")
+{
+    check_overflow_exhaustively<std::int8_t>();
+    check_overflow_exhaustively<std::uint8_t>();
+}
@@ -0,0 +1,216 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#include <strong_type/flat_map.hpp>
+#include <strong_type/ordered.hpp>
+#include <strong_type/ordered_with.hpp>
+#include <strong_type/regular.hpp>
+#include <strong_type/transparent.hpp>
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <set>
+#include <string>
+#include <vector>
+#endif
+
+namespace {
+using key = strong::type<int, struct key_, strong::regular, strong::ordered>;
+
+template <typename Layout>
+void check_against_std_set(int n)
+{
+    std::vector<key> ks;
+    std::set<key> ref;
+    for (int i = 0; i != n; ++i)
+    {
+        ks.emplace_back(i * 2);
+        ref.insert(key{i * 2});
+    }
+    const strong::flat_set<key, std::less<key>, Layout> s(ks.rbegin(), ks.rend());
+    REQUIRE(s.size() == ref.size());
+    for (int i = -1; i <= 2 * n; ++i)
+    {
+        const auto found = s.find(key{i});
+        if (ref.count(key{i}))
+        {
+            REQUIRE(found != s.end());
+            REQUIRE(*found == key{i});
+            REQUIRE(s.contains(key{i}));
+        }
+        else
+        {
+            REQUIRE(found == s.end());
+            REQUIRE_FALSE(s.contains(key{i}));
+        }
+    }
+}
+}
+
+TEST_CASE("a flat_set is sorted and holds each key once")
+{
+    const strong::flat_set<key> s{key{3}, key{1}, key{2}, key{3}, key{1}};
+    REQUIRE(s.size() == 3U);
+    REQUIRE(s.keys() == std::vector<key>{key{1}, key{2}, key{3}});
+    REQUIRE(s.count(key{2}) == 1U);
+    REQUIRE(s.count(key{4}) == 0U);
+    REQUIRE(*s.lower_bound(key{2}) == key{2});
+    REQUIRE(*s.upper_bound(key{2}) == key{3});
+    REQUIRE(s.upper_bound(key{3}) == s.end());
+}
+
+TEST_CASE("a sorted flat_set finds exactly its keys")
+{
+    for (int n = 0; n != 70; ++n)
+    {
+        check_against_std_set<strong::layout::sorted>(n);
+    }
+}
+
+TEST_CASE("an eytzinger flat_set finds exactly its keys")
+{
+    for (int n = 0; n != 70; ++n)
+    {
+        check_against_std_set<strong::layout::eytzinger>(n);
+    }
+}
+
+TEST_CASE("an eytzinger flat_set stores the keys breadth first")
+{
+    const strong::flat_set<key, std::less<key>, strong::layout::eytzinger> s{
+        key{1}, key{2}, key{3}, key{4}, key{5}, key{6}, key{7}};
+    REQUIRE(s.keys() == std::vector<key>{key{4}, key{2}, key{6}, key{1}, key{3}, key{5}, key{7}});
+}
+
+TEST_CASE("keys can be inserted into and erased from a sorted flat_set")
+{
+    strong::flat_set<key> s;
+    REQUIRE(s.empty());
+    auto r = s.insert(key{2});
+    REQUIRE(r.second);
+    REQUIRE(*r.first == key{2});
+    REQUIRE(s.insert(key{1}).second);
+    REQUIRE(s.insert(key{3}).second);
+    r = s.insert(key{2});
+    REQUIRE_FALSE(r.second);
+    REQUIRE(*r.first == key{2});
+    REQUIRE(s.keys() == std::vector<key>{key{1}, key{2}, key{3}});
+    REQUIRE(s.erase(key{2}) == 1U);
+    REQUIRE(s.erase(key{2}) == 0U);
+    REQUIRE(s.keys() == std::vector<key>{key{1}, key{3}});
+}
+
+TEST_CASE("a flat_map keeps the first value of equivalent keys, in separate arrays")
+{
+    const strong::flat_map<key, std::string> m{{key{2}, "two"}, {key{1}, "one"}, {key{2}, "deux"}};
+    REQUIRE(m.size() == 2U);
+    REQUIRE(m.keys() == std::vector<key>{key{1}, key{2}});
+    REQUIRE(m.values() == std::vector<std::string>{"one", "two"});
+    REQUIRE(m.at(key{2}) == "two");
+    REQUIRE_THROWS_AS(m.at(key{3}), std::out_of_range);
+    auto i = m.find(key{1});
+    REQUIRE(i != m.end());
+    REQUIRE(i->first == key{1});
+    REQUIRE(i->second == "one");
+    ++i;
+    REQUIRE((*i).second == "two");
+    REQUIRE(++i == m.end());
+    REQUIRE(m.find(key{0}) == m.end());
+}
+
+TEST_CASE("values in a flat_map can be changed through find, at and operator[]")
+{
+    strong::flat_map<key, int> m;
+    m[key{3}] = 3;
+    m[key{1}] = 1;
+    REQUIRE(m.insert(key{2}, 2).second);
+    REQUIRE_FALSE(m.insert(key{2}, 4).second);
+    m.find(key{2})->second += 10;
+    m.at(key{1}) += 10;
+    ++m[key{3}];
+    REQUIRE(m.keys() == std::vector<key>{key{1}, key{2}, key{3}});
+    REQUIRE(m.values() == std::vector<int>{11, 12, 4});
+    REQUIRE(m.erase(key{2}) == 1U);
+    REQUIRE(m.values() == std::vector<int>{11, 4});
+    int sum = 0;
+    for (auto kv : m) sum += kv.second;
+    REQUIRE(sum == 15);
+}
+
+TEST_CASE("a flat_map can hold bool values")
+{
+    strong::flat_map<key, bool> m{{key{2}, true}, {key{1}, false}};
+    REQUIRE(m.find(key{2})->second);
+    REQUIRE_FALSE(m.begin()->second);
+    m[key{1}] = true;
+    m.at(key{2}) = false;
+    REQUIRE_FALSE(m[key{3}]);
+    REQUIRE(m.values() == std::vector<bool>{true, false, false});
+    int n = 0;
+    for (auto kv : m) n += kv.second ? 1 : 0;
+    REQUIRE(n == 1);
+    const auto& cm = m;
+    REQUIRE(cm.find(key{1})->second);
+    REQUIRE(cm.find(key{4}) == cm.end());
+}
+
+namespace {
+struct counted
+{
+    static int made;
+    counted() { ++made; }
+    int value = 0;
+};
+int counted::made = 0;
+}
+
+TEST_CASE("operator[] only makes a value for a key that is not there")
+{
+    strong::flat_map<key, counted> m;
+    counted::made = 0;
+    m[key{1}].value = 1;
+    REQUIRE(counted::made == 1);
+    m[key{1}].value += 1;
+    REQUIRE(counted::made == 1);
+    REQUIRE(m.at(key{1}).value == 2);
+}
+
+TEST_CASE("an eytzinger flat_map finds the value of each key")
+{
+    std::vector<std::pair<key, int>> kvs;
+    for (int i = 0; i != 100; ++i) kvs.emplace_back(key{i}, i * 10);
+    const strong::flat_map<key, int, std::less<key>, strong::layout::eytzinger> m(kvs.begin(), kvs.end());
+    for (int i = 0; i != 100; ++i)
+    {
+        REQUIRE(m.at(key{i}) == i * 10);
+    }
+    REQUIRE_FALSE(m.contains(key{100}));
+}
+
+namespace {
+using name = strong::type<std::string, struct name_,
+                          strong::regular,
+                          strong::ordered,
+                          strong::ordered_with<std::string>>;
+}
+
+TEST_CASE("a flat_map with a transparent comparator is searched with the underlying type")
+{
+    const strong::flat_map<name, int, strong::transparent_less<name>> m{{name{"b"}, 2}, {name{"a"}, 1}};
+    REQUIRE(m.at(std::string("a")) == 1);
+    REQUIRE(m.contains(std::string("b")));
+    REQUIRE(m.find(std::string("c")) == m.end());
+    const strong::flat_set<name, strong::transparent_less<name>, strong::layout::eytzinger> s{name{"b"}, name{"a"}};
+    REQUIRE(s.count(std::string("a")) == 1U);
+}
@@ -12,9 +12,21 @@
  */
 
 #include "strong_type/formattable.hpp"
+#include "strong_type/interned.hpp"
 
 #include "catch2.hpp"
 
+#if FMT_VERSION >= 90000
+#include <fmt/compile.h>
+#endif
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+#endif
+
 struct so {
     so(int v) : i(v) {}
     int i;
@@ -58,3 +70,82 @@ TEST_CASE("formattable and ostreamable is formattable as formattable")
     auto s = fmt::format("{}", val);
     REQUIRE(s == "3");
 }
+
+#if defined(STRONG_TYPE_HAS_INTERNED)
+using fmt_symbol = strong::interned<struct fmt_symbol_, strong::formattable>;
+
+TEST_CASE("an interned string is formatted as the string")
+{
+    fmt_symbol s{"interned"};
+    REQUIRE(fmt::format("{}", s) == "interned");
+    REQUIRE(fmt::format("{:>10}", s) == "  interned");
+}
+#endif
+
+#if FMT_VERSION >= 90000 && STRONG_HAS_FMT_OSTREAM && STRONG_FMT_DIRECT_OSTREAMABLE
+using osint = strong::type<int, struct osint_, strong::ostreamable>;
+using osstring = strong::type<std::string, struct osstring_, strong::ostreamable>;
+using osdouble = strong::type<double, struct osdouble_, strong::ostreamable>;
+using osbool = strong::type<bool, struct osbool_, strong::ostreamable>;
+
+TEST_CASE("ostreamable integers and strings are formatted with the formatter of the underlying type")
+{
+    REQUIRE(fmt::format("{}", osint{-42}) == "-42");
+    REQUIRE(fmt::format("{:x}", osint{255}) == "ff");
+    REQUIRE(fmt::format("{:>5}", osstring{"ab"}) == "   ab");
+}
+
+TEST_CASE("ostreamable floating point values and bools are still formatted as streamed")
+{
+    REQUIRE(fmt::format("{}", osdouble{0.1234567891}) == "0.123457");
+    REQUIRE(fmt::format("{}", osbool{true}) == "1");
+}
+#endif
+
+#if FMT_VERSION >= 90000
+using fmt_id = strong::type<std::int64_t, struct fmt_id_, strong::formattable>;
+using fmt_uid = strong::type<std::uint64_t, struct fmt_uid_, strong::formattable>;
+
+TEST_CASE("formattable integers are formatted with compiled format strings")
+{
+    REQUIRE(fmt::format(FMT_COMPILE("{}"), fmt_id{-1234}) == "-1234");
+    REQUIRE(fmt::format(FMT_COMPILE("id={}!"), fmt_id{0}) == "id=0!");
+    REQUIRE(fmt::format(FMT_COMPILE("{:08x}"), fmt_id{255}) == "000000ff");
+    REQUIRE(fmt::format(FMT_COMPILE("{:>6}"), fmt_id{42}) == "    42");
+    REQUIRE(fmt::format("{:+}", fmt_id{42}) == "+42");
+    char buf[4];
+    const auto r = fmt::format_to_n(buf, sizeof(buf), FMT_COMPILE("{}"), fmt_id{123456});
+    REQUIRE(r.size == 6U);
+    REQUIRE(std::string(buf, r.out) == "1234");
+}
+
+TEST_CASE("formattable integers of all magnitudes are formatted as the underlying value")
+{
+    const std::int64_t ivalues[] = {0, 9, 10, 99, 100, -1, -10, -100, 1234567,
+                                    std::numeric_limits<std::int64_t>::min(),
+                                    std::numeric_limits<std::int64_t>::max()};
+    for (auto v : ivalues)
+    {
+        REQUIRE(fmt::format("{}", fmt_id{v}) == fmt::format("{}", v));
+    }
+    const auto umax = std::numeric_limits<std::uint64_t>::max();
+    REQUIRE(fmt::format("{}", fmt_uid{umax}) == fmt::format("{}", umax));
+}
+
+TEST_CASE("strong::format_to_n writes at most n characters of an integer")
+{
+    char buf[24];
+    auto r = strong::format_to_n(buf, sizeof(buf), fmt_id{-9876});
+    REQUIRE(r.size == 5U);
+    REQUIRE(std::string(buf, r.out) == "-9876");
+    r = strong::format_to_n(buf, 3, fmt_id{-9876});
+    REQUIRE(r.size == 5U);
+    REQUIRE(std::string(buf, r.out) == "-98");
+    r = strong::format_to_n(buf, sizeof(buf), fmt_id{std::numeric_limits<std::int64_t>::min()});
+    REQUIRE(std::string(buf, r.out) == "-9223372036854775808");
+    std::string s;
+    const auto sr = strong::format_to_n(std::back_inserter(s), 100, fmt_uid{std::numeric_limits<std::uint64_t>::max()});
+    REQUIRE(sr.size == 20U);
+    REQUIRE(s == "18446744073709551615");
+}
+#endif
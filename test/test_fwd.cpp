@@ -0,0 +1,68 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+// fwd.hpp must come first, so that nothing else has declared the names.
+#include <strong_type/fwd.hpp>
+
+namespace {
+using handle = strong::type<int, struct handle_, strong::regular, strong::ordered, strong::ostreamable>;
+using slot = strong::type<unsigned, struct slot_, strong::regular, strong::incrementable>;
+using table = strong::type<int*, struct table_, strong::indexed<slot>, strong::pointer>;
+using cells = strong::type<int*, struct cells_, strong::indexed<>>;
+using point = strong::type<int, struct point_, strong::affine_point<>>;
+
+handle next(const handle& h);
+
+struct registry
+{
+    handle* first;
+    table* entries;
+};
+}
+
+#include "catch2.hpp"
+
+#include <strong_type/strong_type.hpp>
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <sstream>
+#endif
+
+namespace {
+handle next(const handle& h)
+{
+    return handle{value_of(h) + 1};
+}
+}
+
+TEST_CASE("a type declared with only fwd.hpp is usable once defined")
+{
+    handle h{3};
+    registry r{&h, nullptr};
+    REQUIRE(next(*r.first) == handle{4});
+    std::ostringstream os;
+    os << next(h);
+    REQUIRE(os.str() == "4");
+}
+
+TEST_CASE("default modifier arguments from fwd.hpp apply")
+{
+    int a[] = {1, 2, 3};
+    cells c{a};
+    REQUIRE(c[1] == 2);
+    static_assert(std::is_same<strong::indexed<>, strong::indexed<void>>::value, "");
+    static_assert(std::is_same<strong::affine_point<>, strong::affine_point<void>>::value, "");
+    point p1{3};
+    point p2{5};
+    REQUIRE(value_of(p2 - p1) == 2);
+}
@@ -32,3 +32,52 @@ TEST_CASE("strong::hashable can be used in unordered_set")
     REQUIRE(strings.find(hs{"bar"}) != strings.end());
     REQUIRE(strings.find(hs{"baz"}) == strings.end());
 }
+
+namespace {
+struct constant_hash
+{
+    std::size_t operator()(int) const noexcept { return 42U; }
+};
+}
+
+TEST_CASE("strong::hashable_with hashes the underlying value with the given hasher")
+{
+    using hi = strong::type<int, struct hi_, strong::hashable_with<constant_hash>>;
+    REQUIRE(std::hash<hi>{}(hi{1}) == 42U);
+    REQUIRE(std::hash<hi>{}(hi{2}) == 42U);
+    STATIC_REQUIRE(noexcept(std::hash<hi>{}(hi{1})));
+}
+
+TEST_CASE("the mixing hashers spread sequential values over the low bits")
+{
+    using mi = strong::type<std::uint64_t, struct mi_, strong::hashable_with<strong::murmur_mix_hash>>;
+    using fi = strong::type<std::uint64_t, struct fi_, strong::hashable_with<strong::folded_multiply_hash>>;
+    // Values that differ only above the low 8 bits land in 256 buckets
+    // indexed by the low 8 bits of the hash. With the identity, they would
+    // all be in bucket 0.
+    std::unordered_set<std::size_t> murmur_buckets;
+    std::unordered_set<std::size_t> folded_buckets;
+    for (std::uint64_t i = 0; i != 1024; ++i)
+    {
+        murmur_buckets.insert(std::hash<mi>{}(mi{i << 8U}) & 0xffU);
+        folded_buckets.insert(std::hash<fi>{}(fi{i << 8U}) & 0xffU);
+    }
+    REQUIRE(murmur_buckets.size() > 200U);
+    REQUIRE(folded_buckets.size() > 200U);
+}
+
+TEST_CASE("strong::hashable_with can be used in unordered_set")
+{
+    using hs = strong::type<std::string, struct hs_, strong::hashable_with<strong::murmur_mix_hash>, strong::regular>;
+
+    std::unordered_set<hs> strings{hs{"foo"}, hs{"bar"}};
+
+    REQUIRE(strings.find(hs{"foo"}) != strings.end());
+    REQUIRE(strings.find(hs{"baz"}) == strings.end());
+}
+
+TEST_CASE("folded multiply is the xor of the halves of the 128 bit product")
+{
+    STATIC_REQUIRE(strong::impl::folded_multiply(0x123456789abcdefULL, 0xfedcba9876543210ULL) == 0x2317228f48165bb2ULL);
+    STATIC_REQUIRE(strong::impl::folded_multiply(1ULL << 32U, 1ULL << 32U) == 1U);
+}
@@ -0,0 +1,133 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#include <strong_type/id_vector.hpp>
+#include <strong_type/regular.hpp>
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <iterator>
+#include <string>
+#include <vector>
+#endif
+
+namespace {
+using user_id = strong::type<std::uint32_t, struct user_id_, strong::regular>;
+using group_id = strong::type<std::uint32_t, struct group_id_, strong::regular>;
+using small_id = strong::type<std::uint8_t, struct small_id_, strong::regular>;
+using signed_id = strong::type<std::int8_t, struct signed_id_, strong::regular>;
+
+template <typename C, typename I, typename = void>
+struct can_index : std::false_type {};
+template <typename C, typename I>
+struct can_index<C, I, strong::impl::void_t<decltype(std::declval<C&>()[std::declval<const I&>()])>> : std::true_type {};
+}
+
+static_assert(can_index<strong::id_vector<user_id, int>, user_id>{}, "");
+static_assert(!can_index<strong::id_vector<user_id, int>, group_id>{}, "");
+static_assert(!can_index<strong::id_vector<user_id, int>, std::size_t>{}, "");
+static_assert(!can_index<strong::id_span<user_id, int>, group_id>{}, "");
+static_assert(!can_index<strong::id_array<user_id, int, 3>, int>{}, "");
+static_assert(sizeof(strong::id_array<user_id, int, 3>) == sizeof(std::array<int, 3>), "");
+
+static_assert(strong::impl::id_index<small_id>::id_count == 256U, "");
+static_assert(strong::impl::id_index<signed_id>::id_count == 128U, "");
+
+static_assert(std::is_same<std::iterator_traits<strong::id_range<user_id>::iterator>::iterator_category,
+                           std::input_iterator_tag>{}, "");
+#if defined(__cpp_lib_ranges)
+static_assert(std::forward_iterator<strong::id_range<user_id>::iterator>);
+#endif
+
+TEST_CASE("an id_vector does not hand out an id twice when the id type is full")
+{
+    strong::id_vector<small_id, int> v;
+    REQUIRE(v.max_size() == 256U);
+    for (int i = 0; i != 256; ++i) REQUIRE(v.push_back(i) == small_id{static_cast<std::uint8_t>(i)});
+    REQUIRE(v.back() == 255);
+    REQUIRE_THROWS_AS(v.next_id(), std::length_error);
+    REQUIRE_THROWS_AS(v.push_back(256), std::length_error);
+    REQUIRE_THROWS_AS(v.emplace_back(256), std::length_error);
+    REQUIRE(v.size() == 256U);
+    REQUIRE(v[small_id{0}] == 0);
+    REQUIRE_THROWS_AS(v.resize(257), std::length_error);
+    REQUIRE_THROWS_AS((strong::id_vector<signed_id, int>(129)), std::length_error);
+    strong::id_vector<signed_id, int> s(128);
+    REQUIRE(s.size() == 128U);
+}
+
+TEST_CASE("push_back to an id_vector returns the id of the new value")
+{
+    strong::id_vector<user_id, std::string> names;
+    REQUIRE(names.empty());
+    REQUIRE(names.next_id() == user_id{0});
+    const auto alice = names.push_back("alice");
+    const auto bob = names.emplace_back(3U, 'b');
+    REQUIRE(alice == user_id{0});
+    REQUIRE(bob == user_id{1});
+    REQUIRE(names.size() == 2U);
+    REQUIRE(names[alice] == "alice");
+    REQUIRE(names[bob] == "bbb");
+    names[bob] = "bob";
+    REQUIRE(names.at(bob) == "bob");
+    REQUIRE(names.contains(bob));
+    REQUIRE_FALSE(names.contains(user_id{2}));
+    REQUIRE_THROWS_AS(names.at(user_id{2}), std::out_of_range);
+    REQUIRE(names.next_id() == user_id{2});
+}
+
+TEST_CASE("the ids of an id_vector are iterated in order")
+{
+    strong::id_vector<user_id, int> v{10, 20, 30};
+    std::vector<user_id> ids;
+    for (auto id : v.ids()) ids.push_back(id);
+    REQUIRE(ids == std::vector<user_id>{user_id{0}, user_id{1}, user_id{2}});
+    int sum = 0;
+    for (auto i : v) sum += i;
+    REQUIRE(sum == 60);
+    REQUIRE(value_of(v) == std::vector<int>{10, 20, 30});
+}
+
+TEST_CASE("an id_span views an id_vector or an id_array")
+{
+    strong::id_vector<user_id, int> v{1, 2, 3};
+    strong::id_span<user_id, int> s = v;
+    REQUIRE(s.size() == 3U);
+    s[user_id{1}] = 5;
+    REQUIRE(v[user_id{1}] == 5);
+    strong::id_span<user_id, const int> cs = s;
+    REQUIRE(cs[user_id{2}] == 3);
+    REQUIRE(cs.contains(user_id{2}));
+    REQUIRE_FALSE(cs.contains(user_id{3}));
+    const strong::id_vector<user_id, int>& cv = v;
+    strong::id_span<user_id, const int> cvs = cv;
+    REQUIRE(cvs.data() == v.data());
+    std::size_t n = 0;
+    for (auto id : cs.ids()) n += static_cast<std::size_t>(cs[id]);
+    REQUIRE(n == 9U);
+}
+
+TEST_CASE("an id_array is an aggregate indexed by id")
+{
+    strong::id_array<group_id, int, 3> a{{7, 8, 9}};
+    REQUIRE(a.size() == 3U);
+    REQUIRE(a[group_id{2}] == 9);
+    a[group_id{0}] = 1;
+    REQUIRE(value_of(a)[0] == 1);
+    strong::id_span<group_id, int> s = a;
+    REQUIRE(s[group_id{1}] == 8);
+    std::uint32_t last = 0;
+    for (auto id : a.ids()) last = value_of(id);
+    REQUIRE(last == 2U);
+}
@@ -17,6 +17,11 @@
 
 #include "test_utils.hpp"
 
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <stdexcept>
+#include <vector>
+#endif
+
 TEST_CASE("indexed can be accessed using operator [] and .at()")
 {
     using I = strong::type<unsigned, struct I_>;
@@ -113,3 +118,48 @@ TEST_CASE("indexed can be accessed with operator[] without at()")
     REQUIRE(a[1] == 4);
     REQUIRE(std::move(as_const(a))[2] == 5);
 }
+
+TEST_CASE("indexed with bounds::checked throws on an index out of bounds")
+{
+    using I = strong::type<int, struct I_>;
+    using V = strong::type<std::vector<int>, struct v_, strong::indexed<I, strong::bounds::checked>>;
+    using VV = strong::type<std::vector<int>, struct v_, strong::indexed<void, strong::bounds::checked>>;
+
+    V v{std::vector<int>{1, 2, 3}};
+    REQUIRE(v[I{2}] == 3);
+    v[I{0}] = 4;
+    REQUIRE(::as_const(v)[I{0}] == 4);
+    REQUIRE_THROWS_AS(v[I{3}], std::out_of_range);
+    REQUIRE_THROWS_AS(::as_const(v)[I{-1}], std::out_of_range);
+    REQUIRE_THROWS_AS(std::move(v)[I{3}], std::out_of_range);
+    static_assert(!noexcept(v[I{0}]), "");
+
+    VV vv{std::vector<int>{1, 2, 3}};
+    REQUIRE(vv[I{1}] == 2);
+    REQUIRE(vv[1U] == 2);
+    REQUIRE_THROWS_AS(vv[3U], std::out_of_range);
+}
+
+TEST_CASE("indexed with unchecked, hardened and assume_in_bounds forwards an index in bounds")
+{
+    using I = strong::type<unsigned, struct I_>;
+    using U = strong::type<std::vector<int>, struct v_, strong::indexed<I, strong::bounds::unchecked>>;
+    using H = strong::type<std::vector<int>, struct v_, strong::indexed<I, strong::bounds::hardened>>;
+    using A = strong::type<std::vector<int>, struct v_, strong::indexed<I, strong::bounds::assume_in_bounds>>;
+
+    static_assert(std::is_same<U, strong::type<std::vector<int>, struct v_, strong::indexed<I>>>{}, "");
+
+    U u{std::vector<int>{1, 2, 3}};
+    H h{std::vector<int>{1, 2, 3}};
+    A a{std::vector<int>{1, 2, 3}};
+    static_assert(noexcept(h[I{0U}]) == noexcept(std::declval<std::vector<int>&>()[0U]), "");
+    static_assert(noexcept(a[I{0U}]) == noexcept(std::declval<std::vector<int>&>()[0U]), "");
+    static_assert(std::is_same<decltype(h[I{0U}]), int&>{}, "");
+    static_assert(std::is_same<decltype(::as_const(a)[I{0U}]), const int&>{}, "");
+    int sum = 0;
+    for (unsigned i = 0; i != 3U; ++i)
+    {
+        sum += u[I{i}] + h[I{i}] + a[I{i}];
+    }
+    REQUIRE(sum == 18);
+}
@@ -0,0 +1,121 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#include <strong_type/interned.hpp>
+
+#if defined(STRONG_TYPE_HAS_INTERNED)
+
+#include <strong_type/hashable.hpp>
+#include <strong_type/ordered.hpp>
+#include <strong_type/ostreamable.hpp>
+#include <strong_type/regular.hpp>
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <algorithm>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#endif
+
+namespace {
+using symbol = strong::interned<struct symbol_, strong::regular, strong::ordered, strong::hashable, strong::ostreamable>;
+using tenant = strong::interned<struct tenant_, strong::regular>;
+}
+
+static_assert(sizeof(symbol) == sizeof(std::uint32_t));
+static_assert(std::is_trivially_copyable<symbol>{});
+static_assert(!std::is_convertible<symbol, tenant>{});
+
+TEST_CASE("equal strings give the same id, and different strings different ids")
+{
+    const symbol a{"alpha"};
+    const symbol b{std::string("alpha")};
+    const symbol c{std::string_view("beta")};
+    REQUIRE(value_of(a).id() == value_of(b).id());
+    REQUIRE(a == b);
+    REQUIRE(a != c);
+    REQUIRE(value_of(c).view() == "beta");
+}
+
+TEST_CASE("a default constructed interned string is the empty string with id 0")
+{
+    const symbol s;
+    REQUIRE(value_of(s).id() == 0U);
+    REQUIRE(value_of(s).view().empty());
+    REQUIRE(s == symbol{""});
+}
+
+TEST_CASE("each tag has its own pool")
+{
+    const auto before = strong::intern_pool<struct tenant_>::instance().size();
+    const tenant t{"a string only used as a tenant"};
+    REQUIRE(strong::intern_pool<struct tenant_>::instance().size() == before + 1);
+    const tenant again{"a string only used as a tenant"};
+    REQUIRE(strong::intern_pool<struct tenant_>::instance().size() == before + 1);
+    REQUIRE(t == again);
+}
+
+TEST_CASE("interned strings are ordered by id, or lexically with lexical_less")
+{
+    const symbol z{"zz first interned"};
+    const symbol a{"aa second interned"};
+    REQUIRE(z < a);
+    REQUIRE(strong::lexical_less{}(a, z));
+    REQUIRE_FALSE(strong::lexical_less{}(z, a));
+    REQUIRE_FALSE(strong::lexical_less{}(a, a));
+    std::vector<symbol> v{z, a};
+    std::sort(v.begin(), v.end(), strong::lexical_less{});
+    REQUIRE(v.front() == a);
+}
+
+TEST_CASE("interned strings are hashed by id")
+{
+    const symbol s{"hashed"};
+    REQUIRE(std::hash<symbol>{}(s) == std::hash<std::uint32_t>{}(value_of(s).id()));
+    std::unordered_set<symbol> set{symbol{"x"}, symbol{"y"}, symbol{"x"}};
+    REQUIRE(set.size() == 2U);
+    REQUIRE(set.count(symbol{"y"}) == 1U);
+}
+
+TEST_CASE("an interned string is printed as the string")
+{
+    std::ostringstream os;
+    os << symbol{"printed"};
+    REQUIRE(os.str() == "printed");
+}
+
+TEST_CASE("strings can be interned concurrently")
+{
+    std::vector<std::thread> threads;
+    std::vector<std::vector<symbol>> results(4);
+    for (std::size_t t = 0; t != results.size(); ++t)
+    {
+        threads.emplace_back([&results, t] {
+            for (int i = 0; i != 1000; ++i)
+            {
+                results[t].emplace_back("concurrent " + std::to_string(i));
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    for (const auto& r : results)
+    {
+        REQUIRE(r == results.front());
+    }
+    REQUIRE(value_of(results[2][17]).view() == "concurrent 17");
+}
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <sstream>
+#include <unordered_set>
+#include <vector>
+#endif
+
+import strong_type;
+
+namespace {
+using meters = strong::type<int, struct meters_, strong::regular, strong::arithmetic, strong::ordered, strong::hashable, strong::ostreamable>;
+using samples = strong::type<std::vector<int>, struct samples_, strong::range>;
+}
+
+TEST_CASE("modifiers are available through import strong_type")
+{
+    meters m{3};
+    m += meters{4};
+    REQUIRE(m == meters{7});
+    REQUIRE(m > meters{6});
+    REQUIRE(value_of(-m) == -7);
+    STATIC_REQUIRE(strong::type_is_v<meters, strong::equality>);
+}
+
+TEST_CASE("std specializations are available through import strong_type")
+{
+    std::unordered_set<meters> s{meters{1}, meters{2}};
+    REQUIRE(s.count(meters{2}) == 1U);
+    REQUIRE(std::numeric_limits<meters>::max() == meters{std::numeric_limits<int>::max()});
+    std::ostringstream os;
+    os << meters{3};
+    REQUIRE(os.str() == "3");
+}
+
+TEST_CASE("a strong::range can be iterated over when imported")
+{
+    samples s{1, 2, 3};
+    int sum = 0;
+    for (auto v : s) sum += v;
+    REQUIRE(sum == 6);
+}
@@ -0,0 +1,186 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#include <strong_type/radix_sort.hpp>
+#include <strong_type/regular.hpp>
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <vector>
+#endif
+
+namespace {
+template <typename T>
+using sortable = strong::type<T, struct sortable_, strong::regular, strong::ordered>;
+using unordered = strong::type<int, struct unordered_, strong::regular>;
+using text = strong::type<std::string, struct text_, strong::regular, strong::ordered>;
+
+template <typename R, typename = void>
+struct can_radix_sort : std::false_type {};
+template <typename R>
+struct can_radix_sort<R, strong::impl::void_t<decltype(strong::radix_sort(std::declval<R&>()))>> : std::true_type {};
+
+template <typename T>
+std::vector<sortable<T>> random_values(std::size_t n)
+{
+    std::uint64_t x = 88172645463325252ULL;
+    std::vector<sortable<T>> r;
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        r.emplace_back(static_cast<T>(x));
+    }
+    return r;
+}
+
+template <typename T>
+void check_sorts_as_std_sort(std::size_t n)
+{
+    auto v = random_values<T>(n);
+    auto expected = v;
+    std::sort(expected.begin(), expected.end());
+    strong::radix_sort(v);
+    REQUIRE(v == expected);
+}
+}
+
+static_assert(can_radix_sort<std::vector<sortable<int>>>{}, "");
+static_assert(can_radix_sort<std::vector<sortable<double>>>{}, "");
+static_assert(!can_radix_sort<std::vector<unordered>>{}, "");
+static_assert(!can_radix_sort<std::vector<text>>{}, "");
+static_assert(!can_radix_sort<std::vector<int>>{}, "");
+
+TEST_CASE("radix_sort sorts strong integers as std::sort does")
+{
+    for (std::size_t n : {0U, 1U, 2U, 63U, 64U, 1000U, 100000U})
+    {
+        check_sorts_as_std_sort<std::int8_t>(n);
+        check_sorts_as_std_sort<std::uint8_t>(n);
+        check_sorts_as_std_sort<std::int16_t>(n);
+        check_sorts_as_std_sort<std::int32_t>(n);
+        check_sorts_as_std_sort<std::uint32_t>(n);
+        check_sorts_as_std_sort<std::int64_t>(n);
+        check_sorts_as_std_sort<std::uint64_t>(n);
+    }
+}
+
+TEST_CASE("radix_sort sorts strong floating point values as std::sort does")
+{
+    using F = sortable<float>;
+    using D = sortable<double>;
+    std::vector<F> fs;
+    std::vector<D> ds;
+    for (int i = -500; i != 500; ++i)
+    {
+        fs.emplace_back(static_cast<float>((i * 7919) % 1000) / 7.0f);
+        ds.emplace_back(static_cast<double>((i * 7919) % 1000) * 1e100);
+    }
+    fs.emplace_back(std::numeric_limits<float>::infinity());
+    fs.emplace_back(-std::numeric_limits<float>::infinity());
+    fs.emplace_back(std::numeric_limits<float>::denorm_min());
+    ds.emplace_back(-std::numeric_limits<double>::max());
+    ds.emplace_back(std::numeric_limits<double>::lowest());
+    auto fexpected = fs;
+    std::sort(fexpected.begin(), fexpected.end());
+    auto dexpected = ds;
+    std::sort(dexpected.begin(), dexpected.end());
+    strong::radix_sort(fs);
+    strong::radix_sort(ds);
+    REQUIRE(fs == fexpected);
+    REQUIRE(ds == dexpected);
+}
+
+TEST_CASE("radix_sort puts -0.0 before +0.0")
+{
+    using D = sortable<double>;
+    std::array<D, 2> v{{D{0.0}, D{-0.0}}};
+    strong::radix_sort(v);
+    REQUIRE(std::signbit(value_of(v[0])));
+    REQUIRE_FALSE(std::signbit(value_of(v[1])));
+}
+
+namespace {
+// Equal values that can be told apart, to see that the sort is stable.
+struct numbered : sortable<int>
+{
+    numbered(int v, int n) : sortable<int>(v), number(n) {}
+    int number;
+};
+}
+
+TEST_CASE("radix_sort keeps the order of equal values, also below the threshold")
+{
+    for (std::size_t n : {50U, 10000U})
+    {
+        std::vector<numbered> v;
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            v.emplace_back(static_cast<int>((i * 37) % 7) - 3, static_cast<int>(i));
+        }
+        strong::radix_sort(v);
+        REQUIRE(std::is_sorted(v.begin(), v.end(), [](const numbered& lh, const numbered& rh) {
+            return value_of(lh) < value_of(rh) || (value_of(lh) == value_of(rh) && lh.number < rh.number);
+        }));
+    }
+}
+
+TEST_CASE("radix_sort sorts through iterators that are not pointers")
+{
+    auto v = random_values<std::int32_t>(1000);
+    std::deque<sortable<std::int32_t>> d(v.begin(), v.end());
+    std::sort(v.begin(), v.end());
+    strong::radix_sort(d);
+    REQUIRE(std::equal(d.begin(), d.end(), v.begin(), v.end()));
+    auto w = random_values<std::int32_t>(1000);
+    strong::radix_sort(w.begin(), w.end());
+    REQUIRE(w == v);
+}
+
+namespace {
+using timestamp = sortable<std::int64_t>;
+struct event
+{
+    timestamp time;
+    int sequence;
+};
+}
+
+TEST_CASE("radix_sort_by_key is a stable sort on a strong key")
+{
+    for (std::size_t n : {10U, 10000U})
+    {
+        std::vector<event> events;
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            events.push_back(event{timestamp{static_cast<std::int64_t>((i * 37) % 11) - 5}, static_cast<int>(i)});
+        }
+        auto expected = events;
+        std::stable_sort(expected.begin(), expected.end(),
+                         [](const event& lh, const event& rh) { return lh.time < rh.time; });
+        strong::radix_sort_by_key(events, [](const event& e) { return e.time; });
+        REQUIRE(std::equal(events.begin(), events.end(), expected.begin(), expected.end(),
+                           [](const event& lh, const event& rh) {
+                               return lh.time == rh.time && lh.sequence == rh.sequence;
+                           }));
+    }
+}
@@ -17,9 +17,9 @@
 
 #include <strong_type/saturating_arithmetic.hpp>
 
-#ifdef __cpp_lib_saturation_arithmetic
-
+#if CATCH2 == 3
 #include <catch2/catch_template_test_macros.hpp>
+#endif
 
 #include "strong_type/equality.hpp"
 
@@ -32,7 +32,7 @@ TEMPLATE_TEST_CASE("saturating + limits the result to max/min for the underlying
     REQUIRE(value_of(max + type{1}) == value_of(max));
     REQUIRE(value_of(max + max) == value_of(max));
     REQUIRE(value_of(min + min) == value_of(min));
-    if constexpr (std::is_signed_v<TestType>)
+    if (std::is_signed<TestType>::value)
     {
         REQUIRE(value_of(min + type{-1}) == value_of(min));
     }
@@ -46,7 +46,7 @@ TEMPLATE_TEST_CASE("saturating - limits the result to max/min for the underlying
     REQUIRE(value_of(min - type{1}) == value_of(min));
     REQUIRE(value_of(min - max) == value_of(min));
     REQUIRE(value_of(max - min) == value_of(max));
-    if constexpr (std::is_signed_v<TestType>)
+    if (std::is_signed<TestType>::value)
     {
         REQUIRE(value_of(max - type{-1}) == value_of(max));
     }
@@ -129,4 +129,139 @@ TEST_CASE("saturating_cast", "[saturating]")
         REQUIRE(value_of(strong::saturating_cast<utype>(-1)) == 0);
     }
 }
-#endif
\ No newline at end of file
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <cstdint>
+#include <vector>
+#endif
+
+namespace {
+template <typename T>
+void check_branchless_exhaustively()
+{
+    constexpr int min = std::numeric_limits<T>::min();
+    constexpr int max = std::numeric_limits<T>::max();
+    int wrong_sums = 0;
+    int wrong_differences = 0;
+    for (int a = min; a <= max; ++a)
+    {
+        for (int b = min; b <= max; ++b)
+        {
+            const auto sum = std::min(std::max(a + b, min), max);
+            const auto difference = std::min(std::max(a - b, min), max);
+            wrong_sums += strong::impl::branchless_add_sat(static_cast<T>(a), static_cast<T>(b)) != sum;
+            wrong_differences += strong::impl::branchless_sub_sat(static_cast<T>(a), static_cast<T>(b)) != difference;
+        }
+    }
+    REQUIRE(wrong_sums == 0);
+    REQUIRE(wrong_differences == 0);
+}
+
+template <typename T>
+void check_scalar_exhaustively()
+{
+    constexpr int min = std::numeric_limits<T>::min();
+    constexpr int max = std::numeric_limits<T>::max();
+    auto clamp = [&](int v) { return std::min(std::max(v, min), max); };
+    int wrong = 0;
+    for (int a = min; a <= max; ++a)
+    {
+        for (int b = min; b <= max; ++b)
+        {
+            const auto ta = static_cast<T>(a);
+            const auto tb = static_cast<T>(b);
+            wrong += strong::impl::add_sat(ta, tb) != clamp(a + b);
+            wrong += strong::impl::sub_sat(ta, tb) != clamp(a - b);
+            wrong += strong::impl::mul_sat(ta, tb) != clamp(a * b);
+            wrong += b != 0 && strong::impl::div_sat(ta, tb) != clamp(a / b);
+        }
+    }
+    REQUIRE(wrong == 0);
+}
+}
+
+TEST_CASE("branchless saturating add and sub are exact for 8 bit types")
+{
+    check_branchless_exhaustively<std::int8_t>();
+    check_branchless_exhaustively<std::uint8_t>();
+}
+
+TEST_CASE("scalar saturating operations are exact for 8 bit types")
+{
+    check_scalar_exhaustively<std::int8_t>();
+    check_scalar_exhaustively<std::uint8_t>();
+}
+
+TEST_CASE("branchless saturating add and sub limit 64 bit types")
+{
+    using lim = std::numeric_limits<std::int64_t>;
+    using strong::impl::branchless_add_sat;
+    using strong::impl::branchless_sub_sat;
+    REQUIRE(branchless_add_sat<std::int64_t>(lim::max(), 1) == lim::max());
+    REQUIRE(branchless_add_sat<std::int64_t>(lim::min(), -1) == lim::min());
+    REQUIRE(branchless_add_sat<std::int64_t>(lim::max(), lim::min()) == -1);
+    REQUIRE(branchless_add_sat<std::int64_t>(3, -5) == -2);
+    REQUIRE(branchless_sub_sat<std::int64_t>(lim::min(), 1) == lim::min());
+    REQUIRE(branchless_sub_sat<std::int64_t>(lim::max(), -1) == lim::max());
+    REQUIRE(branchless_sub_sat<std::int64_t>(-1, lim::min()) == lim::max());
+    REQUIRE(branchless_sub_sat<std::int64_t>(0, lim::min()) == lim::max());
+    REQUIRE(branchless_sub_sat<std::int64_t>(3, 5) == -2);
+    REQUIRE(branchless_add_sat<std::uint64_t>(~0ULL, 1U) == ~0ULL);
+    REQUIRE(branchless_sub_sat<std::uint64_t>(1U, 2U) == 0U);
+    REQUIRE(branchless_add_sat<std::int32_t>(0x7fffffff, 1) == 0x7fffffff);
+    REQUIRE(branchless_sub_sat<std::int32_t>(-0x7fffffff, 2) == -0x7fffffff - 1);
+}
+
+#if defined(STRONG_TYPE_HAS_SPAN)
+TEST_CASE("span saturating_add and saturating_sub work element by element")
+{
+    using sample = strong::type<std::int16_t, struct sample_>;
+    std::vector<sample> dst{sample{30000}, sample{-30000}, sample{5}, sample{7}};
+    const std::vector<sample> src{sample{10000}, sample{-10000}, sample{-6}, sample{1}};
+    strong::saturating_add(std::span<sample>{dst}, src);
+    REQUIRE(value_of(dst[0]) == 32767);
+    REQUIRE(value_of(dst[1]) == -32768);
+    REQUIRE(value_of(dst[2]) == -1);
+    REQUIRE(value_of(dst[3]) == 8);
+    strong::saturating_sub(std::span<sample>{dst}, src);
+    REQUIRE(value_of(dst[0]) == 22767);
+    REQUIRE(value_of(dst[1]) == -22768);
+    REQUIRE(value_of(dst[2]) == 5);
+    REQUIRE(value_of(dst[3]) == 7);
+}
+
+TEST_CASE("span saturating kernels agree with the scalar ones for long spans")
+{
+    using sample = strong::type<std::int16_t, struct sample_>;
+    std::vector<sample> dst;
+    std::vector<sample> src;
+    for (int i = 0; i != 77; ++i)
+    {
+        dst.emplace_back(static_cast<std::int16_t>(i * 997 - 32768));
+        src.emplace_back(static_cast<std::int16_t>(32767 - i * 1733));
+    }
+    auto sum = dst;
+    strong::saturating_add(std::span<sample>{sum}, src);
+    auto difference = dst;
+    strong::saturating_sub(std::span<sample>{difference}, src);
+    for (std::size_t i = 0; i != dst.size(); ++i)
+    {
+        REQUIRE(value_of(sum[i]) == strong::impl::branchless_add_sat(value_of(dst[i]), value_of(src[i])));
+        REQUIRE(value_of(difference[i]) == strong::impl::branchless_sub_sat(value_of(dst[i]), value_of(src[i])));
+    }
+}
+
+TEST_CASE("span saturating kernels only touch the common length")
+{
+    using pixel = strong::type<std::uint8_t, struct pixel_>;
+    std::vector<pixel> dst{pixel{250}, pixel{3}, pixel{9}};
+    const std::vector<pixel> src{pixel{10}, pixel{5}};
+    strong::saturating_add(std::span<pixel>{dst}, src);
+    REQUIRE(value_of(dst[0]) == 255);
+    REQUIRE(value_of(dst[1]) == 8);
+    REQUIRE(value_of(dst[2]) == 9);
+    strong::saturating_sub(std::span<pixel>{dst}, std::span<const pixel>{src}.first(2));
+    REQUIRE(value_of(dst[0]) == 245);
+    REQUIRE(value_of(dst[1]) == 3);
+}
+#endif
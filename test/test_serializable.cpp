@@ -0,0 +1,184 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#include <strong_type/serializable.hpp>
+#include <strong_type/cached_hash.hpp>
+#include <strong_type/equality.hpp>
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <cstdint>
+#include <vector>
+#endif
+
+namespace {
+using seq_le = strong::type<std::uint32_t, struct seq_, strong::serializable<strong::endian::little>, strong::equality>;
+using seq_be = strong::type<std::uint32_t, struct seq_, strong::serializable<strong::endian::big>, strong::equality>;
+using port = strong::type<std::uint16_t, struct port_, strong::serializable<strong::endian::big>, strong::equality>;
+using offset = strong::type<std::int64_t, struct offset_, strong::serializable<strong::endian::big>, strong::equality>;
+using ratio = strong::type<double, struct ratio_, strong::serializable<strong::endian::big>, strong::equality>;
+using flag = strong::type<std::uint8_t, struct flag_, strong::serializable<strong::endian::big>, strong::equality>;
+
+struct point { std::int16_t x; std::int16_t y; std::int32_t z; };
+using position = strong::type<point, struct position_, strong::serializable<strong::endian::native>>;
+
+using hashed = strong::type<std::uint32_t, struct hashed_, strong::serializable<strong::endian::big>, strong::equality, strong::cached_hash>;
+
+template <typename T, typename = void>
+struct has_write_to : std::false_type {};
+template <typename T>
+struct has_write_to<T, strong::impl::void_t<decltype(std::declval<const T&>().write_to(std::declval<unsigned char*>()))>>
+    : std::true_type {};
+}
+
+static_assert(seq_le::wire_size() == 4, "");
+static_assert(strong::wire_size_v<offset> == 8, "");
+static_assert(strong::wire_size_v<position> == sizeof(point), "");
+static_assert(has_write_to<port>::value, "");
+static_assert(!has_write_to<strong::type<int, struct plain_>>::value, "");
+static_assert(strong::type_is_v<port, strong::serializable<strong::endian::big>>, "");
+static_assert(!strong::type_is_v<port, strong::serializable<strong::endian::little>>, "");
+
+TEST_CASE("write_to writes the bytes in the chosen byte order")
+{
+    unsigned char buf[4];
+    auto p = seq_be{0x01020304}.write_to(buf);
+    REQUIRE(p == buf + 4);
+    REQUIRE(buf[0] == 1);
+    REQUIRE(buf[1] == 2);
+    REQUIRE(buf[2] == 3);
+    REQUIRE(buf[3] == 4);
+    seq_le{0x01020304}.write_to(buf);
+    REQUIRE(buf[0] == 4);
+    REQUIRE(buf[1] == 3);
+    REQUIRE(buf[2] == 2);
+    REQUIRE(buf[3] == 1);
+}
+
+TEST_CASE("read_from reads the bytes in the chosen byte order")
+{
+    const unsigned char buf[] = { 0x12, 0x34, 0xff };
+    port p{0};
+    auto next = p.read_from(buf);
+    REQUIRE(next == buf + 2);
+    REQUIRE(p == port{0x1234});
+    flag f{0};
+    f.read_from(next);
+    REQUIRE(f == flag{0xff});
+}
+
+TEST_CASE("values are read back as they were written")
+{
+    char buf[64];
+    char* p = buf;
+    p = port{8080}.write_to(p);
+    p = offset{-1234567890123}.write_to(p);
+    p = ratio{-0.125}.write_to(p);
+    p = seq_le{0xdeadbeef}.write_to(p);
+    p = position{point{-1, 2, -3}}.write_to(p);
+    REQUIRE(p - buf == 2 + 8 + 8 + 4 + static_cast<std::ptrdiff_t>(sizeof(point)));
+
+    const char* q = buf;
+    port pt{0};
+    offset o{0};
+    ratio r{0.0};
+    seq_le s{0U};
+    position pos{point{0, 0, 0}};
+    q = pt.read_from(q);
+    q = o.read_from(q);
+    q = r.read_from(q);
+    q = s.read_from(q);
+    q = pos.read_from(q);
+    REQUIRE(q == p);
+    REQUIRE(pt == port{8080});
+    REQUIRE(o == offset{-1234567890123});
+    REQUIRE(r == ratio{-0.125});
+    REQUIRE(s == seq_le{0xdeadbeef});
+    REQUIRE(value_of(pos).x == -1);
+    REQUIRE(value_of(pos).y == 2);
+    REQUIRE(value_of(pos).z == -3);
+}
+
+TEST_CASE("bulk write_to and read_from handle many values")
+{
+    std::vector<seq_be> values;
+    for (std::uint32_t i = 0; i != 10; ++i) values.emplace_back(i * 0x01010101U);
+    std::vector<unsigned char> buf(values.size() * seq_be::wire_size());
+    auto end = write_to(buf.data(), values.data(), values.size());
+    REQUIRE(end == buf.data() + buf.size());
+    REQUIRE(buf[4] == 1);
+    REQUIRE(buf[7] == 1);
+
+    std::vector<seq_be> back(values.size(), seq_be{0U});
+    auto rend = read_from(static_cast<const unsigned char*>(buf.data()), back.data(), back.size());
+    REQUIRE(rend == buf.data() + buf.size());
+    REQUIRE(back == values);
+}
+
+TEST_CASE("bulk write_to in native byte order is the underlying bytes")
+{
+    const seq_le values[] = { seq_le{1U}, seq_le{0x10203040U} };
+    unsigned char buf[8];
+    write_to(buf, values, 2);
+    seq_le back[2] = { seq_le{0U}, seq_le{0U} };
+    read_from(static_cast<const unsigned char*>(buf), back, 2);
+    REQUIRE(back[0] == values[0]);
+    REQUIRE(back[1] == values[1]);
+    REQUIRE(buf[0] == 1);
+    REQUIRE(buf[4] == 0x40);
+}
+
+TEST_CASE("read_from goes through value_of, so a cached hash is updated")
+{
+    const unsigned char buf[] = { 0, 0, 0, 42 };
+    hashed h{1U};
+    const auto before = h.hash();
+    h.read_from(buf);
+    REQUIRE(h == hashed{42U});
+    REQUIRE(h.hash() == hashed{42U}.hash());
+    REQUIRE(h.hash() != before);
+
+    std::vector<hashed> many(2, hashed{0U});
+    const unsigned char two[] = { 0, 0, 0, 1, 0, 0, 0, 2 };
+    read_from(two, many.data(), many.size());
+    REQUIRE(many[1] == hashed{2U});
+    REQUIRE(many[1].hash() == hashed{2U}.hash());
+}
+
+#if __cplusplus >= 201703L
+TEST_CASE("std::byte buffers can be used")
+{
+    std::byte buf[2];
+    port{0xabcd}.write_to(buf);
+    REQUIRE(buf[0] == std::byte{0xab});
+    REQUIRE(buf[1] == std::byte{0xcd});
+    port p{0};
+    p.read_from(static_cast<const std::byte*>(buf));
+    REQUIRE(p == port{0xabcd});
+}
+#endif
+
+#if defined(STRONG_TYPE_HAS_SPAN)
+TEST_CASE("bulk write_to and read_from take spans")
+{
+    std::vector<port> values{port{1}, port{2}, port{0x0304}};
+    std::vector<std::byte> buf(values.size() * port::wire_size());
+    auto end = write_to(buf.data(), values);
+    REQUIRE(end == buf.data() + buf.size());
+    REQUIRE(buf[5] == std::byte{4});
+    std::vector<port> back(values.size(), port{0});
+    read_from(static_cast<const std::byte*>(buf.data()), std::span<port>(back));
+    REQUIRE(back == values);
+}
+#endif
@@ -26,6 +26,12 @@
 #include <strong_type/ordered_with.hpp>
 #include <strong_type/convertible_to.hpp>
 #include <strong_type/scalable_with.hpp>
+#include <strong_type/unique.hpp>
+#include <strong_type/cached_hash.hpp>
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <string>
+#endif
 
 namespace {
 // a single modifier: one empty base, folded by every ABI
@@ -48,6 +54,43 @@ using conv_to = strong::type<int, struct conv_to_, strong::convertible_to<long,
 using scale_with = strong::type<int, struct scale_with_, strong::scalable_with<int, long>>;
 
 using range = strong::type<std::vector<int>, struct range_, strong::range, strong::equality>;
+
+// cached_hash is the one modifier with data: the hash and a flag telling if it
+// is valid, in the modifier base, so before the value.
+using cached = strong::type<std::string, struct cached_, strong::regular, strong::cached_hash>;
+
+// move only, with a move constructor and destructor that are not trivial,
+// but which the author knows can be relocated by copying its bytes
+class handle
+{
+public:
+    explicit handle(int fd) : fd_(fd) {}
+    handle(handle&& h) noexcept : fd_(h.fd_) { h.fd_ = -1; }
+    handle& operator=(handle&& h) noexcept { std::swap(fd_, h.fd_); return *this; }
+    ~handle() { fd_ = -1; }
+private:
+    int fd_;
+};
+
+// neither trivially relocatable nor declared so
+class self_referencing
+{
+public:
+    self_referencing() : self_(this) {}
+    self_referencing(const self_referencing&) : self_(this) {}
+    self_referencing& operator=(const self_referencing&) { return *this; }
+private:
+    self_referencing* self_;
+};
+
+using unique_int = strong::type<int, struct unique_int_, strong::unique>;
+using unique_handle = strong::type<handle, struct unique_handle_, strong::unique>;
+using self_ref = strong::type<self_referencing, struct self_ref_, strong::semiregular>;
+}
+
+namespace strong {
+template <>
+struct is_trivially_relocatable<handle> : std::true_type {};
 }
 
 TEST_CASE("a strong::type is the same size as its underlying type")
@@ -65,3 +108,27 @@ TEST_CASE("a strong::type is the same size as its underlying type")
     STATIC_REQUIRE(sizeof(scale_with) == sizeof(int));
     STATIC_REQUIRE(sizeof(range) == sizeof(std::vector<int>));
 }
+
+TEST_CASE("a strong::type with cached_hash stores the hash and a flag before the value")
+{
+    STATIC_REQUIRE(sizeof(cached) == sizeof(std::string) + 2 * sizeof(std::size_t));
+    cached c{"foo"};
+    const auto* p = reinterpret_cast<const char*>(&c);
+    REQUIRE(reinterpret_cast<const char*>(&value_of(static_cast<const cached&>(c))) == p + 2 * sizeof(std::size_t));
+    STATIC_REQUIRE(!strong::is_trivially_relocatable_v<cached>);
+}
+
+TEST_CASE("a strong::type is trivially relocatable if its underlying type is")
+{
+    STATIC_REQUIRE(strong::is_trivially_relocatable<int>::value);
+    STATIC_REQUIRE(strong::is_trivially_relocatable_v<one_leaf>);
+    STATIC_REQUIRE(strong::is_trivially_relocatable_v<many_leaves>);
+    STATIC_REQUIRE(strong::is_trivially_relocatable_v<is_regular>);
+    STATIC_REQUIRE(strong::is_trivially_relocatable_v<streamable>);
+    STATIC_REQUIRE(strong::is_trivially_relocatable_v<eq_with>);
+    STATIC_REQUIRE(strong::is_trivially_relocatable_v<scale_with>);
+    STATIC_REQUIRE(strong::is_trivially_relocatable_v<unique_int>);
+    STATIC_REQUIRE(strong::is_trivially_relocatable_v<unique_handle>);
+    STATIC_REQUIRE(!strong::is_trivially_relocatable_v<self_referencing>);
+    STATIC_REQUIRE(!strong::is_trivially_relocatable_v<self_ref>);
+}
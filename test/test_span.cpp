@@ -0,0 +1,71 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#include <strong_type/span.hpp>
+
+#if defined(STRONG_TYPE_HAS_SPAN)
+
+#include <strong_type/arithmetic.hpp>
+#include <strong_type/regular.hpp>
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <array>
+#include <vector>
+#endif
+
+namespace {
+using meters = strong::type<float, struct meters_, strong::arithmetic, strong::regular>;
+}
+
+TEST_CASE("as_underlying views strong values as underlying values")
+{
+    std::vector<meters> v{meters{1.0f}, meters{2.0f}, meters{3.0f}};
+    std::span<meters> s{v};
+    auto u = strong::as_underlying(s);
+    STATIC_REQUIRE(std::is_same<decltype(u), std::span<float>>{});
+    REQUIRE(u.size() == 3U);
+    REQUIRE(u.data() == &value_of(v[0]));
+    u[1] = 5.0f;
+    REQUIRE(v[1] == meters{5.0f});
+}
+
+TEST_CASE("as_underlying of const strong values gives const underlying values")
+{
+    const std::array<meters, 2> a{meters{1.0f}, meters{2.0f}};
+    auto u = strong::as_underlying(std::span{a});
+    STATIC_REQUIRE(std::is_same<decltype(u), std::span<const float, 2>>{});
+    REQUIRE(u[0] == 1.0f);
+    REQUIRE(u[1] == 2.0f);
+}
+
+TEST_CASE("as_strong views underlying values as strong values")
+{
+    std::vector<float> v{1.0f, 2.0f, 3.0f};
+    auto s = strong::as_strong<meters>(std::span<float>{v});
+    STATIC_REQUIRE(std::is_same<decltype(s), std::span<meters>>{});
+    REQUIRE(s.size() == 3U);
+    s[2] += meters{1.0f};
+    REQUIRE(v[2] == 4.0f);
+}
+
+TEST_CASE("as_strong of const underlying values gives const strong values")
+{
+    const std::array<float, 3> a{1.0f, 2.0f, 3.0f};
+    auto s = strong::as_strong<meters>(std::span{a});
+    STATIC_REQUIRE(std::is_same<decltype(s), std::span<const meters, 3>>{});
+    REQUIRE(s[1] == meters{2.0f});
+}
+
+#endif
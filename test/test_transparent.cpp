@@ -0,0 +1,149 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#include <strong_type/transparent.hpp>
+#include <strong_type/equality_with.hpp>
+#include <strong_type/ordered.hpp>
+#include <strong_type/ordered_with.hpp>
+#include <strong_type/regular.hpp>
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+#endif
+
+namespace {
+using user_name = strong::type<std::string, struct user_name_,
+                               strong::regular,
+                               strong::hashable,
+                               strong::ordered,
+                               strong::equality_with<std::string>,
+                               strong::ordered_with<std::string>>;
+using mixed_name = strong::type<std::string, struct mixed_name_,
+                                strong::regular,
+                                strong::hashable_with<strong::murmur_mix_hash>,
+                                strong::equality_with<std::string>>;
+using wide_id = strong::type<long long, struct wide_id_,
+                             strong::regular,
+                             strong::hashable,
+                             strong::equality_with<int>>;
+
+template <typename F, typename A, typename = void>
+struct can_call : std::false_type {};
+template <typename F, typename A>
+struct can_call<F, A, strong::impl::void_t<decltype(std::declval<const F&>()(std::declval<const A&>()))>> : std::true_type {};
+}
+
+static_assert(can_call<strong::transparent_hash<user_name>, user_name>{}, "");
+static_assert(can_call<strong::transparent_hash<user_name>, std::string>{}, "");
+static_assert(!can_call<strong::transparent_hash<user_name>, int>{}, "");
+static_assert(can_call<strong::transparent_hash<user_name>, const char*>{}, "");
+static_assert(can_call<strong::transparent_hash<user_name>, char[4]>{}, "");
+static_assert(!can_call<strong::transparent_hash<user_name>, mixed_name>{}, "");
+static_assert(can_call<strong::transparent_hash<wide_id>, long long>{}, "");
+static_assert(!can_call<strong::transparent_hash<wide_id>, int>{}, "");
+
+TEST_CASE("transparent_hash hashes a comparable type like the strong type")
+{
+    const strong::transparent_hash<user_name> h;
+    REQUIRE(h(user_name{"foo"}) == h(std::string("foo")));
+    const strong::transparent_hash<mixed_name> mh;
+    REQUIRE(mh(mixed_name{"foo"}) == mh(std::string("foo")));
+    REQUIRE(mh(mixed_name{"foo"}) == std::hash<mixed_name>{}(mixed_name{"foo"}));
+}
+
+TEST_CASE("transparent_hash hashes a string literal like the string it equals")
+{
+    const strong::transparent_hash<user_name> h;
+    REQUIRE(h("foo") == h(user_name{"foo"}));
+    const char* p = "bar";
+    REQUIRE(h(p) == h(user_name{"bar"}));
+    const strong::transparent_hash<mixed_name> mh;
+    REQUIRE(mh("foo") == mh(mixed_name{"foo"}));
+}
+
+TEST_CASE("transparent_equal and transparent_less compare with the strong type on either side")
+{
+    const strong::transparent_equal<user_name> eq;
+    REQUIRE(eq(user_name{"foo"}, user_name{"foo"}));
+    REQUIRE(eq(user_name{"foo"}, std::string("foo")));
+    REQUIRE(eq(std::string("foo"), user_name{"foo"}));
+    REQUIRE_FALSE(eq(user_name{"foo"}, std::string("bar")));
+    const strong::transparent_less<user_name> less;
+    REQUIRE(less(user_name{"bar"}, user_name{"foo"}));
+    REQUIRE(less(user_name{"bar"}, std::string("foo")));
+    REQUIRE_FALSE(less(std::string("foo"), user_name{"bar"}));
+}
+
+TEST_CASE("a std::map with transparent_less is searched with the underlying type")
+{
+    std::map<user_name, int, strong::transparent_less<user_name>> m{{user_name{"foo"}, 1}, {user_name{"bar"}, 2}};
+    const std::string key = "bar";
+    auto i = m.find(key);
+    REQUIRE(i != m.end());
+    REQUIRE(i->second == 2);
+    REQUIRE(m.find(std::string("baz")) == m.end());
+    REQUIRE(m.find("foo") != m.end());
+    std::set<user_name, strong::transparent_less<user_name>> s{user_name{"foo"}};
+    REQUIRE(s.count(std::string("foo")) == 1U);
+}
+
+#if defined(__cpp_lib_generic_unordered_lookup)
+TEST_CASE("a std::unordered_map with transparent hash and equal is searched with the underlying type")
+{
+    std::unordered_map<user_name, int,
+                       strong::transparent_hash<user_name>,
+                       strong::transparent_equal<user_name>> m{{user_name{"foo"}, 1}, {user_name{"bar"}, 2}};
+    const std::string key = "foo";
+    auto i = m.find(key);
+    REQUIRE(i != m.end());
+    REQUIRE(i->second == 1);
+    REQUIRE(m.find(std::string("baz")) == m.end());
+    REQUIRE(m.find("bar") != m.end());
+    REQUIRE(m.find("baz") == m.end());
+}
+#endif
+
+#if __cplusplus >= 201703L
+namespace {
+using view_name = strong::type<std::string, struct view_name_,
+                               strong::regular,
+                               strong::hashable_with<strong::folded_multiply_hash>,
+                               strong::ordered,
+                               strong::equality_with<std::string_view>,
+                               strong::ordered_with<std::string_view>>;
+}
+
+TEST_CASE("a strong string key is hashed and compared with a std::string_view")
+{
+    const std::string_view v = "foo";
+    REQUIRE(strong::transparent_hash<view_name>{}(v) == strong::transparent_hash<view_name>{}(view_name{"foo"}));
+    REQUIRE(strong::transparent_equal<view_name>{}(view_name{"foo"}, v));
+    std::map<view_name, int, strong::transparent_less<view_name>> m{{view_name{"foo"}, 1}};
+    REQUIRE(m.find(v) != m.end());
+#if defined(__cpp_lib_generic_unordered_lookup)
+    std::unordered_map<view_name, int,
+                       strong::transparent_hash<view_name>,
+                       strong::transparent_equal<view_name>> um{{view_name{"foo"}, 1}};
+    REQUIRE(um.find(v) != um.end());
+    REQUIRE(um.find(std::string_view("bar")) == um.end());
+#endif
+}
+#endif
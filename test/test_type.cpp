@@ -29,6 +29,29 @@ TEST_CASE("default_constructible initializes with underlying default constructor
     REQUIRE(value_of(vr) == 0);
 }
 
+TEST_CASE("default_uninitialized is default constructible and value initializes to zero")
+{
+    using type = strong::type<int, struct i_, strong::default_uninitialized>;
+    STATIC_REQUIRE(std::is_nothrow_default_constructible<type>{});
+    STATIC_REQUIRE(strong::type_is_v<type, strong::default_constructible>);
+    constexpr type vc{};
+    STATIC_REQUIRE(value_of(vc) == 0);
+    type vr{};
+    REQUIRE(value_of(vr) == 0);
+    auto p = std::make_unique<type[]>(3);
+    REQUIRE(value_of(p[2]) == 0);
+}
+
+#if defined(__cpp_concepts) && __cpp_concepts >= 202002L
+TEST_CASE("default_uninitialized is trivially default constructible")
+{
+    using type = strong::type<int, struct i_, strong::default_uninitialized>;
+    STATIC_REQUIRE(std::is_trivially_default_constructible<type>{});
+    STATIC_REQUIRE(std::is_trivial<type>{});
+    STATIC_REQUIRE(!std::is_trivially_default_constructible<strong::type<int, struct i_, strong::default_constructible>>{});
+}
+#endif
+
 TEST_CASE("Construction from a value type lvalue copies it")
 {
     auto orig = std::make_shared<int>(3);
@@ -250,3 +273,23 @@ TEST_CASE("value can be used as non-type template parameter")
 }
 
 #endif
+
+namespace {
+struct poisoned {
+    template <typename T>
+    class modifier {
+        static_assert(strong::impl::always_false<T>, "poisoned::modifier<> must not be instantiated");
+    };
+};
+struct listed {
+    template <typename T>
+    class modifier {};
+};
+using lazy = strong::type<int, struct lazy_, listed, poisoned>;
+}
+
+TEST_CASE("type_is_v for a literally listed modifier does not instantiate the other modifiers")
+{
+    STATIC_REQUIRE(strong::type_is_v<lazy, listed>);
+    STATIC_REQUIRE(strong::type_is_v<lazy, poisoned>);
+}
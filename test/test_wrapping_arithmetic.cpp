@@ -0,0 +1,81 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#include "catch2.hpp"
+
+#include <strong_type/wrapping_arithmetic.hpp>
+
+#if CATCH2 == 3
+#include <catch2/catch_template_test_macros.hpp>
+#endif
+
+#if !defined(STRONG_TYPE_IMPORT_STD_LIBRARY)
+#include <cstdint>
+#endif
+
+namespace {
+using sequence = strong::type<std::int32_t, struct sequence_, strong::wrapping_arithmetic>;
+using word = strong::type<std::uint16_t, struct word_, strong::wrapping_arithmetic>;
+
+constexpr std::int32_t i32_max = std::numeric_limits<std::int32_t>::max();
+constexpr std::int32_t i32_min = std::numeric_limits<std::int32_t>::min();
+}
+
+// Overflow in a constant expression is a compilation error, so these show
+// that the operations wrap without undefined behaviour.
+static_assert(value_of(sequence{i32_max} + sequence{1}) == i32_min, "");
+static_assert(value_of(sequence{i32_min} - sequence{1}) == i32_max, "");
+static_assert(value_of(sequence{i32_max} * sequence{2}) == -2, "");
+static_assert(value_of(sequence{i32_min} / sequence{-1}) == i32_min, "");
+static_assert(value_of(sequence{i32_min} % sequence{-1}) == 0, "");
+static_assert(value_of(-sequence{i32_min}) == i32_min, "");
+static_assert(value_of(word{0xffff} * word{0xffff}) == 1, "");
+static_assert(noexcept(sequence{1} + sequence{1}), "");
+
+TEMPLATE_TEST_CASE("wrapping arithmetic without overflow gives the plain result", "[wrapping]",
+                   int, short, long long, signed char, unsigned char, unsigned short, unsigned)
+{
+    using type = strong::type<TestType, struct tag, strong::wrapping_arithmetic>;
+    REQUIRE(value_of(type{3} + type{4}) == 7);
+    REQUIRE(value_of(type{7} - type{4}) == 3);
+    REQUIRE(value_of(type{3} * type{4}) == 12);
+    REQUIRE(value_of(type{12} / type{4}) == 3);
+    REQUIRE(value_of(type{14} % type{4}) == 2);
+    type v{10};
+    v += type{5};
+    v -= type{3};
+    v *= type{2};
+    v /= type{4};
+    v %= type{4};
+    REQUIRE(value_of(v) == 2);
+}
+
+TEMPLATE_TEST_CASE("wrapping arithmetic wraps around modulo 2^N", "[wrapping]",
+                   int, short, long long, signed char, unsigned char, unsigned short, unsigned)
+{
+    using type = strong::type<TestType, struct tag, strong::wrapping_arithmetic>;
+    constexpr auto max = std::numeric_limits<TestType>::max();
+    constexpr auto min = std::numeric_limits<TestType>::min();
+    REQUIRE(value_of(type{max} + type{1}) == min);
+    REQUIRE(value_of(type{min} - type{1}) == max);
+    REQUIRE(value_of(type{max} * type{max}) == 1);
+    REQUIRE(value_of(-type{1}) == static_cast<TestType>(~TestType{}));
+}
+
+TEST_CASE("a wrapping sequence number compares in order across the wrap")
+{
+    const sequence before{i32_max - 1};
+    const sequence after = before + sequence{3};
+    REQUIRE(value_of(after) == i32_min + 1);
+    REQUIRE(value_of(after - before) == 3);
+}